@@ -130,6 +130,9 @@ void doClient(unsigned short port)
     // Create an instance of our custom recorder
     NetworkRecorder recorder(server.value(), port);
 
+    // Send the audio in 20 ms packets from a thread of its own, so that the network can't stall the capture
+    recorder.setProcessingBlockSize(882);
+
     // Wait for user input...
     std::cin.ignore(10000, '\n');
     std::cout << "Press enter to start recording audio";
@@ -89,9 +89,11 @@ private:
                                 m_samples.end());
         }
 
-        // Fill audio data to pass to the stream
+        // Fill audio data to pass to the stream, the buffer is not touched
+        // again before the next call so the stream can play it in place
         data.samples     = m_tempBuffer.data();
         data.sampleCount = m_tempBuffer.size();
+        data.persistent  = true;
 
         // Update the playing offset
         m_offset += m_tempBuffer.size();
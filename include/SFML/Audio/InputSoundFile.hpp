@@ -258,6 +258,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32 bit floats
+    ///
+    /// The samples are normalized to the [-1, 1] range. Formats
+    /// that store more than 16 bits per sample (or floats) are
+    /// decoded without going through 16 bit integers, so no
+    /// precision is lost.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -265,6 +281,8 @@ public:
     void close();
 
 private:
+    friend class SoundBuffer;
+
     ////////////////////////////////////////////////////////////
     /// \brief Deleter for input streams that only conditionally deletes
     ///
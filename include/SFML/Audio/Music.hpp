@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <filesystem>
@@ -87,13 +88,14 @@ public:
     /// the `sf::Music` object loads a new music or is destroyed.
     ///
     /// \param filename Path of the music file to open
+    /// \param format   Format of the samples to stream
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `openFromMemory`, `openFromStream`
     ///
     ////////////////////////////////////////////////////////////
-    Music(const std::filesystem::path& filename);
+    Music(const std::filesystem::path& filename, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a music from an audio file in memory
@@ -110,13 +112,14 @@ public:
     ///
     /// \param data        Pointer to the file data in memory
     /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param format      Format of the samples to stream
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `openFromFile`, `openFromStream`
     ///
     ////////////////////////////////////////////////////////////
-    Music(const void* data, std::size_t sizeInBytes);
+    Music(const void* data, std::size_t sizeInBytes, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a music from an audio file in a custom stream
@@ -131,13 +134,14 @@ public:
     /// until the `sf::Music` object loads a new music or is destroyed.
     ///
     /// \param stream Source stream to read from
+    /// \param format Format of the samples to stream
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `openFromFile`, `openFromMemory`
     ///
     ////////////////////////////////////////////////////////////
-    Music(InputStream& stream);
+    Music(InputStream& stream, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
@@ -169,14 +173,20 @@ public:
     /// streamed continuously, the file must remain accessible until
     /// the `sf::Music` object loads a new music or is destroyed.
     ///
+    /// The samples are decoded and streamed in \a `format`. Streaming
+    /// `sf::SampleFormat::Float32` samples keeps the full precision of
+    /// formats that store more than 16 bits per sample, and spares
+    /// the audio engine the conversion from integers.
+    ///
     /// \param filename Path of the music file to open
+    /// \param format   Format of the samples to stream
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `openFromMemory`, `openFromStream`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in memory
@@ -193,13 +203,16 @@ public:
     ///
     /// \param data        Pointer to the file data in memory
     /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param format      Format of the samples to stream
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `openFromFile`, `openFromStream`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] bool openFromMemory(const void*  data,
+                                      std::size_t  sizeInBytes,
+                                      SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in a custom stream
@@ -214,13 +227,14 @@ public:
     /// until the `sf::Music` object loads a new music or is destroyed.
     ///
     /// \param stream Source stream to read from
+    /// \param format Format of the samples to stream
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `openFromFile`, `openFromMemory`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromStream(InputStream& stream);
+    [[nodiscard]] bool openFromStream(InputStream& stream, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Get the total duration of the music
@@ -269,6 +283,58 @@ public:
     ////////////////////////////////////////////////////////////
     void setLoopPoints(TimeSpan timePoints);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the music ahead of playback in a background thread
+    ///
+    /// By default, the music is decoded on the audio thread whenever
+    /// the stream needs new samples. A slow disk or an expensive frame
+    /// to decode can then delay the audio device, which is heard as
+    /// a glitch.
+    ///
+    /// When decoding ahead is enabled, a dedicated thread keeps up to
+    /// \a `duration` of decoded audio in a ring buffer, and the audio
+    /// thread only reads samples from it. Loop points and seeking
+    /// behave the same in both modes. The audio thread never waits
+    /// for the decoding thread: if the ring runs dry, or if a loop
+    /// requires a seek while the decoding thread is busy with a block,
+    /// a few milliseconds of silence are played instead and the
+    /// underrun count is incremented.
+    ///
+    /// Decoding ahead is disabled by default. Like `setLoopPoints()`,
+    /// this function can be called at any point and is applied to a
+    /// playing music without affecting its playing offset.
+    ///
+    /// \param duration Duration of audio to decode ahead, or `sf::Time::Zero` to disable decoding ahead
+    ///
+    /// \see `getDecodeAhead`, `getUnderrunCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDecodeAhead(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of audio decoded ahead of playback
+    ///
+    /// \return Duration of audio decoded ahead, `sf::Time::Zero` if disabled
+    ///
+    /// \see `setDecodeAhead`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDecodeAhead() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the decode-ahead buffer ran dry
+    ///
+    /// Each underrun inserted a few milliseconds of silence in the
+    /// playback. A growing count means that the decode-ahead duration
+    /// is too short for the system the music is played on.
+    ///
+    /// \return Number of underruns since the music was created
+    ///
+    /// \see `setDecodeAhead`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getUnderrunCount() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -304,6 +370,16 @@ protected:
     std::optional<std::uint64_t> onLoop() override;
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill a chunk from the decode-ahead ring buffer
+    ///
+    /// \param data Chunk of data to fill
+    ///
+    /// \return `true` to continue playback, `false` to stop
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool getDecodedData(Chunk& data);
+
     ////////////////////////////////////////////////////////////
     /// \brief Helper to convert an `sf::Time` to a sample position
     ///
@@ -372,6 +448,13 @@ private:
 /// music.play();
 /// \endcode
 ///
+/// If the music is read from a slow medium, or uses a format that is
+/// expensive to decode, `setDecodeAhead()` moves the decoding to a
+/// background thread that stays ahead of the playback:
+/// \code
+/// music.setDecodeAhead(sf::seconds(2));
+/// \endcode
+///
 /// \see `sf::Sound`, `sf::SoundStream`
 ///
 ////////////////////////////////////////////////////////////
@@ -29,11 +29,13 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
 #include <SFML/System/Time.hpp>
 
 #include <filesystem>
+#include <future>
 #include <unordered_set>
 #include <vector>
 
@@ -71,6 +73,18 @@ public:
     ////////////////////////////////////////////////////////////
     SoundBuffer(const SoundBuffer& copy);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    /// The samples are taken over without being copied. The
+    /// sounds that were using \a `other` are detached from it,
+    /// and \a `other` is left empty.
+    ///
+    /// \param other Instance to move from
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBuffer(SoundBuffer&& other) noexcept;
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sound buffer from a file
     ///
@@ -78,13 +92,14 @@ public:
     /// of supported formats.
     ///
     /// \param filename Path of the sound file to load
+    /// \param format   Format of the samples to store in the buffer
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `loadFromMemory`, `loadFromStream`, `loadFromSamples`, `saveToFile`
     ///
     ////////////////////////////////////////////////////////////
-    SoundBuffer(const std::filesystem::path& filename);
+    SoundBuffer(const std::filesystem::path& filename, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sound buffer from a file in memory
@@ -94,13 +109,14 @@ public:
     ///
     /// \param data        Pointer to the file data in memory
     /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param format      Format of the samples to store in the buffer
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `loadFromFile`, `loadFromStream`, `loadFromSamples`
     ///
     ////////////////////////////////////////////////////////////
-    SoundBuffer(const void* data, std::size_t sizeInBytes);
+    SoundBuffer(const void* data, std::size_t sizeInBytes, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sound buffer from a custom stream
@@ -109,13 +125,14 @@ public:
     /// of supported formats.
     ///
     /// \param stream Source stream to read from
+    /// \param format Format of the samples to store in the buffer
     ///
     /// \throws `sf::Exception` if loading was unsuccessful
     ///
     /// \see `loadFromFile`, `loadFromMemory`, `loadFromSamples`
     ///
     ////////////////////////////////////////////////////////////
-    SoundBuffer(InputStream& stream);
+    SoundBuffer(InputStream& stream, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sound buffer from an array of audio samples
@@ -139,6 +156,29 @@ public:
                 unsigned int                     sampleRate,
                 const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the sound buffer from an array of float audio samples
+    ///
+    /// The samples are expected to be normalized to the [-1, 1]
+    /// range. The buffer stores them as `sf::SampleFormat::Float32`.
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    /// \throws `sf::Exception` if loading was unsuccessful
+    ///
+    /// \see `loadFromFile`, `loadFromMemory`, `saveToFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBuffer(const float*                     samples,
+                std::uint64_t                    sampleCount,
+                unsigned int                     channelCount,
+                unsigned int                     sampleRate,
+                const std::vector<SoundChannel>& channelMap);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -151,14 +191,21 @@ public:
     /// See the documentation of `sf::InputSoundFile` for the list
     /// of supported formats.
     ///
+    /// The samples are decoded and stored in \a `format`. Decoding
+    /// to `sf::SampleFormat::Float32` keeps the full precision of
+    /// formats that store more than 16 bits per sample, and spares
+    /// the audio engine the conversion from integers when the sound
+    /// is played.
+    ///
     /// \param filename Path of the sound file to load
+    /// \param format   Format of the samples to store in the buffer
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `loadFromMemory`, `loadFromStream`, `loadFromSamples`, `saveToFile`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename, SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a file in memory
@@ -168,13 +215,16 @@ public:
     ///
     /// \param data        Pointer to the file data in memory
     /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param format      Format of the samples to store in the buffer
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `loadFromFile`, `loadFromStream`, `loadFromSamples`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] bool loadFromMemory(const void*  data,
+                                      std::size_t  sizeInBytes,
+                                      SampleFormat format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a custom stream
@@ -183,13 +233,43 @@ public:
     /// of supported formats.
     ///
     /// \param stream Source stream to read from
+    /// \param format Format of the samples to store in the buffer
     ///
     /// \return `true` if loading succeeded, `false` if it failed
     ///
     /// \see `loadFromFile`, `loadFromMemory`, `loadFromSamples`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromStream(InputStream& stream);
+    [[nodiscard]] bool loadFromStream(InputStream& stream, SampleFormat format = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load several sound buffers from files in parallel
+    ///
+    /// The files are decoded on a pool of worker threads and the
+    /// function returns immediately. Each future becomes ready
+    /// once its file is decoded: `get()` then returns the sound
+    /// buffer, or throws `sf::Exception` if the file could not
+    /// be loaded.
+    ///
+    /// The pool has one thread per hardware thread and is shared
+    /// by all the calls. It is joined when the program exits;
+    /// files that haven't started decoding by then are abandoned.
+    ///
+    /// When there are fewer files than threads, large files whose
+    /// reader can seek to an exact sample (like WAV and FLAC) are
+    /// additionally split into ranges that are decoded in parallel.
+    ///
+    /// \param filenames Paths of the sound files to load
+    /// \param format    Format of the samples to store in the buffers
+    ///
+    /// \return One future per file, in the order of \a `filenames`
+    ///
+    /// \see `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<std::future<SoundBuffer>> loadManyAsync(
+        const std::vector<std::filesystem::path>& filenames,
+        SampleFormat                              format = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from an array of audio samples
@@ -213,11 +293,35 @@ public:
                                        unsigned int                     sampleRate,
                                        const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from an array of float audio samples
+    ///
+    /// The samples are expected to be normalized to the [-1, 1]
+    /// range. The buffer stores them as `sf::SampleFormat::Float32`.
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    /// \param channelMap   Map of position in sample frame to sound channel
+    ///
+    /// \return `true` if loading succeeded, `false` if it failed
+    ///
+    /// \see `loadFromFile`, `loadFromMemory`, `saveToFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromSamples(const float*                     samples,
+                                       std::uint64_t                    sampleCount,
+                                       unsigned int                     channelCount,
+                                       unsigned int                     sampleRate,
+                                       const std::vector<SoundChannel>& channelMap);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
     /// See the documentation of `sf::OutputSoundFile` for the list
-    /// of supported formats.
+    /// of supported formats. Float samples are converted to 16 bit
+    /// signed integers before they are written.
     ///
     /// \param filename Path of the sound file to write
     ///
@@ -233,22 +337,53 @@ public:
     /// The total number of samples in this array is given by the
     /// `getSampleCount()` function.
     ///
+    /// If the buffer stores floats, they are converted the first
+    /// time this function is called, and the converted copy is
+    /// kept until the samples of the buffer change. Use
+    /// `getFloatSamples()` to access them without any conversion.
+    ///
     /// \return Read-only pointer to the array of sound samples
     ///
-    /// \see `getSampleCount`
+    /// \see `getSampleCount`, `getFloatSamples`, `getSampleFormat`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const std::int16_t* getSamples() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the array of float audio samples stored in the buffer
+    ///
+    /// The returned samples are normalized to the [-1, 1] range.
+    /// The total number of samples in this array is given by the
+    /// `getSampleCount()` function.
+    ///
+    /// \return Read-only pointer to the array of sound samples, `nullptr` if the buffer stores 16 bit integers
+    ///
+    /// \see `getSampleCount`, `getSamples`, `getSampleFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const float* getFloatSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples stored in the buffer
+    ///
+    /// \return Sample format, which tells whether `getSamples()`
+    ///         or `getFloatSamples()` gives access to the samples
+    ///         without any conversion
+    ///
+    /// \see `getSamples`, `getFloatSamples`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the number of samples stored in the buffer
     ///
     /// The array of samples can be accessed with the `getSamples()`
-    /// function.
+    /// or `getFloatSamples()` function, depending on the sample format.
     ///
     /// \return Number of samples
     ///
-    /// \see `getSamples`
+    /// \see `getSamples`, `getFloatSamples`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t getSampleCount() const;
@@ -313,18 +448,44 @@ public:
     ////////////////////////////////////////////////////////////
     SoundBuffer& operator=(const SoundBuffer& right);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of move assignment operator
+    ///
+    /// \param right Instance to move from
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBuffer& operator=(SoundBuffer&& right) noexcept;
+
 private:
     friend class Sound;
 
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
     ///
-    /// \param file Sound file providing access to the new loaded sound
+    /// \param file   Sound file providing access to the new loaded sound
+    /// \param format Format of the samples to read from the file
     ///
     /// \return `true` on successful initialization, `false` on failure
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool initialize(InputSoundFile& file);
+    [[nodiscard]] bool initialize(InputSoundFile& file, SampleFormat format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a sound file, decoding ranges of it in parallel
+    ///
+    /// Falls back to a sequential decode when the file is small
+    /// or its format can't seek to an exact sample.
+    ///
+    /// \param filename   Path of the sound file to load
+    /// \param format     Format of the samples to read from the file
+    /// \param rangeCount Maximum number of ranges to decode in parallel
+    ///
+    /// \return `true` on successful initialization, `false` on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool initialize(const std::filesystem::path& filename, SampleFormat format, std::size_t rangeCount);
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the internal buffer with the cached audio samples
@@ -362,11 +523,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::int16_t> m_samples;                        //!< Samples buffer
-    unsigned int              m_sampleRate{44100};              //!< Number of samples per second
-    std::vector<SoundChannel> m_channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
-    Time                      m_duration;                       //!< Sound duration
-    mutable SoundList         m_sounds;                         //!< List of sounds that are using this buffer
+    mutable std::vector<std::int16_t> m_samples;                           //!< Samples buffer, or the 16 bit copy of float samples
+    std::vector<float>                m_floatSamples;                      //!< Samples buffer, when the sample format is float
+    SampleFormat                      m_sampleFormat{SampleFormat::Int16}; //!< Format of the stored samples
+    unsigned int                      m_sampleRate{44100};                 //!< Number of samples per second
+    std::vector<SoundChannel>         m_channelMap{SoundChannel::Mono};    //!< The map of position in sample frame to sound channel
+    Time                              m_duration;                          //!< Sound duration
+    mutable SoundList                 m_sounds;                            //!< List of sounds that are using this buffer
 };
 
 } // namespace sf
@@ -389,6 +552,14 @@ private:
 /// a custom stream (see `sf::InputStream`) or directly from an array
 /// of samples. It can also be saved back to a file.
 ///
+/// Samples can alternatively be stored as 32 bit floats, by passing
+/// `sf::SampleFormat::Float32` to the loading functions or by loading
+/// an array of floats. Files that store more than 16 bits per sample
+/// then keep their full precision, and sounds that go through effect
+/// processors are played without any conversion to integers.
+/// `getSamples()` still works on such buffers, it converts the samples
+/// to 16 bit integers on first use.
+///
 /// Sound buffers alone are not very useful: they hold the audio data
 /// but cannot be played. To do so, you need to use the `sf::Sound` class,
 /// which provides functions to play/pause/stop the sound as well as
@@ -407,6 +578,19 @@ private:
 /// used by a `sf::Sound` (i.e. never write a function that
 /// uses a local `sf::SoundBuffer` instance for loading a sound).
 ///
+/// When many sounds have to be loaded at once, for example
+/// behind a loading screen, `loadManyAsync` decodes them on
+/// several threads:
+/// \code
+/// auto futures = sf::SoundBuffer::loadManyAsync({"jump.wav", "coin.ogg", "theme.flac"});
+///
+/// // ... do other work meanwhile ...
+///
+/// std::vector<sf::SoundBuffer> buffers;
+/// for (auto& future : futures)
+///     buffers.push_back(future.get()); // throws sf::Exception if a file failed to load
+/// \endcode
+///
 /// Usage example:
 /// \code
 /// // Load a new sound buffer from a file
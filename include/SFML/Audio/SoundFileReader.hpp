@@ -105,6 +105,40 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32 bit floats
+    ///
+    /// The samples are normalized to the [-1, 1] range.
+    ///
+    /// The default implementation reads 16 bit samples with `read`
+    /// and converts them. Readers of formats that store samples with
+    /// more precision, or that decode to floats natively, should
+    /// override it to skip that conversion.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether `seek` lands on the exact sample requested
+    ///
+    /// Some formats can only seek to the start of a block of
+    /// samples. Readers that always land on the requested
+    /// sample should override this function to return `true`,
+    /// which allows sound buffers to decode separate ranges
+    /// of a file in parallel.
+    ///
+    /// The default implementation returns `false`.
+    ///
+    /// \return `true` if seeking is sample-accurate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool isSeekExact() const;
 };
 
 } // namespace sf
@@ -157,6 +191,13 @@ public:
 ///         // as 16-bits signed integers in the file
 ///         // return the actual number of samples read
 ///     }
+///
+///     std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override
+///     {
+///         // optional: read up to 'maxCount' samples normalized to [-1, 1]
+///         // into the 'samples' array, if the format can provide them
+///         // directly; by default, the samples returned by 'read' are converted
+///     }
 /// };
 ///
 /// sf::SoundFileFactory::registerReader<MySoundFileReader>();
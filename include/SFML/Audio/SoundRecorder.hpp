@@ -185,6 +185,58 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const std::vector<SoundChannel>& getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Deliver the recorded samples in fixed-size blocks from a processing thread
+    ///
+    /// By default, `onProcessSamples` is called directly on the
+    /// audio capture thread, with chunks of whatever size the
+    /// device delivers. A slow `onProcessSamples` (an encoder,
+    /// a network send, ...) then delays the device and audio
+    /// is dropped.
+    ///
+    /// When a block size is set, the capture thread only copies
+    /// the samples into a preallocated ring buffer that holds
+    /// about one second of audio, and a dedicated processing
+    /// thread calls `onProcessSamples` with blocks of exactly
+    /// \a `frameCount` frames. When the recording stops, the
+    /// remaining samples are delivered as a last, shorter block.
+    /// If `onProcessSamples` falls so far behind that the ring is
+    /// full, the newest samples are dropped and counted in the
+    /// overflow count.
+    ///
+    /// This function must be called before the recording starts.
+    ///
+    /// \param frameCount Number of frames per block, or 0 to call `onProcessSamples` from the capture thread
+    ///
+    /// \see `getProcessingBlockSize`, `getOverflowCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProcessingBlockSize(std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames per block delivered to `onProcessSamples`
+    ///
+    /// \return Number of frames per block, or 0 if samples are delivered from the capture thread
+    ///
+    /// \see `setProcessingBlockSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getProcessingBlockSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples dropped because the ring buffer was full
+    ///
+    /// Only recordings with a processing block size can overflow.
+    /// A non-zero count is also reported to `sf::err()` when the
+    /// recording stops.
+    ///
+    /// \return Number of samples dropped since the recording was started
+    ///
+    /// \see `setProcessingBlockSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getOverflowCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Check if the system supports audio capture
     ///
@@ -313,6 +365,13 @@ private:
 /// in the destructor of your derived class, so that the recording
 /// thread finishes before your object is destroyed.
 ///
+/// If processing the samples takes time, for example to encode
+/// them or to send them over the network, call
+/// `setProcessingBlockSize()` before starting the recording.
+/// `onProcessSamples` is then called from a processing thread of
+/// its own with blocks of a fixed size, and can't delay the
+/// capture device anymore.
+///
 /// Usage example:
 /// \code
 /// class CustomRecorder : public sf::SoundRecorder
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
@@ -57,8 +58,10 @@ public:
     ////////////////////////////////////////////////////////////
     struct Chunk
     {
-        const std::int16_t* samples{};     //!< Pointer to the audio samples
-        std::size_t         sampleCount{}; //!< Number of samples pointed by Samples
+        const std::int16_t* samples{};      //!< Pointer to the audio samples
+        std::size_t         sampleCount{};  //!< Number of samples pointed by Samples
+        bool                persistent{};   //!< Whether the samples stay valid until the next `onGetData` or `onSeek`
+        const float*        floatSamples{}; //!< Pointer to the audio samples, used instead of `samples` by float streams
     };
 
     ////////////////////////////////////////////////////////////
@@ -148,6 +151,15 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::vector<SoundChannel> getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples provided by the stream
+    ///
+    /// \return Sample format, which tells whether `Chunk::samples`
+    ///         or `Chunk::floatSamples` is read
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current status of the stream (stopped, paused, playing)
     ///
@@ -236,12 +248,20 @@ protected:
     /// It can be called multiple times if the settings of the
     /// audio stream change, but only when the stream is stopped.
     ///
+    /// Streams of `sf::SampleFormat::Float32` samples read them from
+    /// `Chunk::floatSamples` instead of `Chunk::samples`, and hand
+    /// them to the audio engine without any conversion.
+    ///
     /// \param channelCount Number of channels of the stream
     /// \param sampleRate   Sample rate, in samples per second
     /// \param channelMap   Map of position in sample frame to sound channel
+    /// \param sampleFormat Format of the samples provided by `onGetData`
     ///
     ////////////////////////////////////////////////////////////
-    void initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap);
+    void initialize(unsigned int                     channelCount,
+                    unsigned int                     sampleRate,
+                    const std::vector<SoundChannel>& channelMap,
+                    SampleFormat                     sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -255,6 +275,13 @@ protected:
     /// the returned array of samples is not empty; this would stop the stream
     /// due to an internal limitation.
     ///
+    /// By default, the stream copies the samples that it can't play
+    /// right away, so that the source is free to overwrite them once
+    /// this function returns. If the samples stay valid and unchanged
+    /// until the next call to `onGetData` or `onSeek`, set
+    /// `data.persistent` to `true`: the stream then plays them in
+    /// place, without any intermediate copy.
+    ///
     /// \param data Chunk of data to fill
     ///
     /// \return `true` to continue playback, `false` to stop
@@ -361,9 +388,13 @@ private:
 ///         // Fill the chunk with audio data from the stream source
 ///         // (note: must not be empty if you want to continue playing)
 ///         data.samples = ...;
+///         data.sampleCount = ...;
+///
+///         // Optional: tell the stream that the samples stay valid
+///         // until the next call, so that they are not copied
+///         data.persistent = true;
 ///
 ///         // Return true to continue playing
-///         data.sampleCount = ...;
 ///         return true;
 ///     }
 ///
@@ -35,7 +35,9 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <deque>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -55,6 +57,8 @@ class ResourceStream;
 namespace sf
 {
 class InputStream;
+class Shader;
+class String;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -242,6 +246,39 @@ public:
                                         bool          bold,
                                         float         outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the glyphs of a set of characters in advance
+    ///
+    /// Glyphs are normally rasterized the first time they are
+    /// requested, and each of them is immediately uploaded to the
+    /// font's texture. Loading a lot of new glyphs at once, for
+    /// example when a text in a new language is displayed for the
+    /// first time, can therefore take a noticeable amount of time.
+    ///
+    /// This function rasterizes all the glyphs of \a `characters`
+    /// for every size of \a `characterSizes` in parallel, on
+    /// background threads that open their own instance of the font.
+    /// The glyphs are then placed in the font textures in order,
+    /// and the glyphs added to each row of a texture are uploaded
+    /// at once. Glyphs that are already loaded are skipped. Fonts
+    /// opened from a stream can't be opened again by other threads,
+    /// their glyphs are rasterized on the calling thread.
+    ///
+    /// \param characters       Characters whose glyphs must be loaded
+    /// \param characterSizes   Character sizes to load the glyphs for
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \return `true` if the glyphs were loaded, `false` if no font is loaded
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool preloadGlyphs(const String&                    characters,
+                       const std::vector<unsigned int>& characterSizes,
+                       bool                             bold             = false,
+                       float                            outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -328,12 +365,34 @@ public:
     /// are requested, thus it is not very relevant. It is mainly
     /// used internally by `sf::Text`.
     ///
+    /// When the texture of a character size is full, it grows
+    /// until it reaches the maximum texture size; only then the
+    /// next glyphs are added to an additional texture. Growing
+    /// doesn't move the glyphs, nor the returned texture object.
+    /// The texture containing a glyph is given by its
+    /// `sf::Glyph::textureIndex` member.
+    ///
     /// \param characterSize Reference character size
+    /// \param textureIndex  Index of the texture, must be lower than `getTextureCount(characterSize)`
     ///
     /// \return Texture containing the glyphs of the requested size
     ///
+    /// \see `getTextureCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(unsigned int characterSize, std::size_t textureIndex = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures containing the loaded glyphs of a certain size
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Number of textures used by the glyphs of the requested size, at least 1
+    ///
+    /// \see `getTexture`
+    ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] const Texture& getTexture(unsigned int characterSize) const;
+    [[nodiscard]] std::size_t getTextureCount(unsigned int characterSize) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
@@ -361,7 +420,78 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the distance field mode
+    ///
+    /// By default, glyphs are rasterized and stored in a texture
+    /// for every character size they are requested with. Texts
+    /// that are drawn with many different sizes, or that are
+    /// continuously scaled, can therefore use a lot of memory.
+    ///
+    /// In distance field mode, glyphs are rasterized once at a
+    /// reference size into signed distance fields, and all the
+    /// character sizes are scaled from them. `sf::Text` then draws
+    /// them with a built-in shader which keeps them sharp at any
+    /// scale. Small sizes look a bit less crisp than with regular
+    /// glyphs since they are not hinted anymore, and outlines are
+    /// limited to a few pixels at the reference size.
+    ///
+    /// The distance field mode requires shaders, and a version of
+    /// FreeType that can render distance fields (2.11 or later);
+    /// it cannot be enabled otherwise. Changing the mode discards
+    /// all the glyphs loaded so far.
+    /// The distance field mode is disabled by default.
+    ///
+    /// \param enabled `true` to enable the distance field mode, `false` to disable it
+    ///
+    /// \see `isDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the distance field mode is enabled or not
+    ///
+    /// \return `true` if glyphs are rendered as distance fields, `false` otherwise
+    ///
+    /// \see `setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader drawing the glyphs in distance field mode
+    ///
+    /// The shader is shared by everything drawn with the font, and
+    /// it is never modified by this function. The distance at which
+    /// it draws the glyphs is given by its `threshold` uniform (see
+    /// `getDistanceFieldThreshold`), which `sf::Text` sets before
+    /// each of its draws. By default the shader draws the filled
+    /// glyphs. It is mainly used internally by `sf::Text`.
+    ///
+    /// \return Shader drawing the glyphs, or a null pointer if the distance field mode is disabled
+    ///
+    /// \see `setDistanceFieldEnabled`, `getDistanceFieldThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Shader* getDistanceFieldShader() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the distance field threshold drawing glyphs of a given size and outline thickness
+    ///
+    /// \param characterSize    Reference character size
+    /// \param outlineThickness Thickness of the outline to draw, 0 to draw the filled glyphs
+    ///
+    /// \return Value of the `threshold` uniform of the distance field shader, in [0, 0.5]
+    ///
+    /// \see `getDistanceFieldShader`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDistanceFieldThreshold(unsigned int characterSize, float outlineThickness = 0) const;
+
 private:
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
     ///
@@ -380,7 +510,99 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using GlyphTable   = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using KerningTable = std::unordered_map<std::uint64_t, float>; //!< Table mapping a pair of glyph indices to their kerning
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a texture into which glyphs are packed
+    ///
+    /// Glyphs are packed on shelves (rows). The rows are indexed
+    /// by height, so that finding the best row for a new glyph
+    /// doesn't require visiting all of them; full rows are removed
+    /// from the index. The texture grows when it is full, until
+    /// it reaches the maximum texture size.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Atlas
+    {
+        Atlas(bool smooth, unsigned int size);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Grow the texture, keeping the glyphs at their position
+        ///
+        /// The glyphs are copied to the new texture by the GPU,
+        /// the texture object itself is preserved.
+        ///
+        /// \param size New width and height of the texture
+        ///
+        ////////////////////////////////////////////////////////////
+        void grow(unsigned int size);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether a row is too full to receive any more glyph
+        ///
+        /// \param row Row of the atlas
+        ///
+        /// \return `true` if the row must not be visited anymore
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isFull(const Row& row) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Start deferring the texture uploads until `endStaging` is called
+        ///
+        ////////////////////////////////////////////////////////////
+        void beginStaging();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Write the pixels of a glyph to the atlas
+        ///
+        /// The pixels are uploaded to the texture, or copied to
+        /// the pixels staged for the glyph's row if staging is
+        /// in progress.
+        ///
+        /// \param glyphPixels Pixels of the glyph
+        /// \param size        Width and height of the glyph's rectangle
+        /// \param dest        Position of the glyph's rectangle in the texture
+        ///
+        ////////////////////////////////////////////////////////////
+        void write(const std::uint8_t* glyphPixels, Vector2u size, Vector2u dest);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Upload the glyphs written since `beginStaging` to the texture, one row at a time
+        ///
+        ////////////////////////////////////////////////////////////
+        void endStaging();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether texture uploads are currently deferred
+        ///
+        /// \return `true` if staging is in progress
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isStaging() const;
+
+        static constexpr unsigned int initialSize{128}; //!< Size of the texture of a new atlas
+        static constexpr unsigned int firstRow{3};      //!< Y position of the first row, below the white square for underlines
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Pixels of the glyphs written to a row while staging
+        ///
+        ////////////////////////////////////////////////////////////
+        struct StagedRow
+        {
+            unsigned int              left{};   //!< X position of the first glyph written to the row while staging
+            unsigned int              height{}; //!< Height of the highest glyph written to the row while staging
+            std::vector<std::uint8_t> pixels;   //!< Pixels from `left` to the right edge of the texture
+        };
+
+        Texture                                  texture;           //!< Square texture containing the pixels of the glyphs
+        unsigned int                             nextRow{firstRow}; //!< Y position of the next new row in the texture
+        std::vector<Row>                         rows;              //!< List containing the position of all the existing rows
+        std::multimap<unsigned int, std::size_t> rowsByHeight;      //!< Index of the rows that are not full, sorted by row height
+        bool                                     staging{};         //!< Are texture uploads deferred?
+        std::map<unsigned int, StagedRow>        stagedRows;        //!< Pixels staged for upload, by Y position of their row (empty unless staging)
+    };
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -390,10 +612,9 @@ private:
     {
         explicit Page(bool smooth);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        GlyphTable        glyphs;   //!< Table mapping code points to their corresponding glyph
+        KerningTable      kernings; //!< Table caching the kerning of the glyph pairs already queried
+        std::deque<Atlas> atlases;  //!< Textures containing the glyphs, new rows are added to the last one (a deque never moves them)
     };
 
     ////////////////////////////////////////////////////////////
@@ -426,15 +647,43 @@ private:
     Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Find a suitable rectangle within the texture for a glyph
+    /// \brief Write the pixels of a rasterized glyph to the textures of a page
+    ///
+    /// \param page   Page of glyphs to write to
+    /// \param size   Width and height of the glyph's pixels, including the padding
+    /// \param pixels Pixels of the glyph
+    /// \param glyph  Glyph whose texture index and texture rectangle are set
+    ///
+    ////////////////////////////////////////////////////////////
+    void placeGlyph(Page& page, Vector2u size, const std::uint8_t* pixels, Glyph& glyph) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of the glyph representing a code point
+    ///
+    /// The indices are looked up once and cached, since this
+    /// is done for every glyph and every kerning pair of a text.
+    ///
+    /// \param codePoint Unicode code point of the character
+    ///
+    /// \return Index of the glyph in the font face, 0 if the glyph is missing
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getGlyphIndex(std::uint32_t codePoint) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a suitable rectangle within the textures of a page for a glyph
+    ///
+    /// The last texture of the page grows when it is full, a new
+    /// texture is only added once it reached the maximum size.
     ///
-    /// \param page Page of glyphs to search in
-    /// \param size Width and height of the rectangle
+    /// \param page         Page of glyphs to search in
+    /// \param size         Width and height of the rectangle
+    /// \param textureIndex Receives the index of the texture containing the rectangle
     ///
     /// \return Found rectangle within the texture
     ///
     ////////////////////////////////////////////////////////////
-    IntRect findGlyphRect(Page& page, Vector2u size) const;
+    IntRect findGlyphRect(Page& page, Vector2u size, unsigned int& textureIndex) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
@@ -460,6 +709,9 @@ private:
     Info                         m_info;           //!< Information about the font
     mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    bool                         m_isDistanceField{}; //!< Status of the distance field mode
+    std::shared_ptr<Shader>      m_distanceFieldShader; //!< Shader drawing the glyphs in distance field mode
+    mutable std::unordered_map<unsigned int, GlyphTable> m_distanceFieldGlyphs; //!< Glyphs scaled from the distance fields, by character size
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
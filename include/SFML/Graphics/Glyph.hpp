@@ -40,11 +40,12 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct SFML_GRAPHICS_API Glyph
 {
-    float     advance{};   //!< Offset to move horizontally to the next character
-    int       lsbDelta{};  //!< Left offset after forced autohint. Internally used by getKerning()
-    int       rsbDelta{};  //!< Right offset after forced autohint. Internally used by getKerning()
-    FloatRect bounds;      //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
-    IntRect   textureRect; //!< Texture coordinates of the glyph inside the font's texture
+    float        advance{};      //!< Offset to move horizontally to the next character
+    int          lsbDelta{};     //!< Left offset after forced autohint. Internally used by getKerning()
+    int          rsbDelta{};     //!< Right offset after forced autohint. Internally used by getKerning()
+    FloatRect    bounds;         //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
+    IntRect      textureRect;    //!< Texture coordinates of the glyph inside the font's texture
+    unsigned int textureIndex{}; //!< Index of the font's texture containing the glyph (see Font::getTexture)
 };
 
 } // namespace sf
@@ -58,7 +59,7 @@ struct SFML_GRAPHICS_API Glyph
 ///
 /// The `sf::Glyph` structure provides the information needed
 /// to handle the glyph:
-/// \li its coordinates in the font's texture
+/// \li its coordinates in the font's texture, and which texture contains it
 /// \li its bounding rectangle
 /// \li the offset to apply to get the starting position of the next glyph
 ///
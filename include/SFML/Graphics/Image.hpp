@@ -35,6 +35,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -135,6 +136,38 @@ public:
     ////////////////////////////////////////////////////////////
     explicit Image(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Image();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    Image(const Image& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Image& operator=(const Image&);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Image(Image&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Image& operator=(Image&&) noexcept;
+
     ////////////////////////////////////////////////////////////
     /// \brief Resize the image and fill it with a unique color
     ///
@@ -165,6 +198,9 @@ public:
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
+    /// The file is mapped in memory and decoded from there,
+    /// when the platform allows it.
+    ///
     /// \param filename Path of the image file to load
     ///
     /// \return `true` if loading was successful
@@ -358,11 +394,26 @@ public:
     void flipVertically();
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Release a pixel buffer
+    ///
+    /// Pixel buffers are allocated like the ones returned by
+    /// the image decoder, so that decoded pixels can be adopted
+    /// as they are instead of being copied.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PixelsDeleter
+    {
+        void operator()(std::uint8_t* pixels) const;
+    };
+
+    using PixelsPtr = std::unique_ptr<std::uint8_t[], PixelsDeleter>;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u                  m_size;   //!< Image size
-    std::vector<std::uint8_t> m_pixels; //!< Pixels of the image
+    Vector2u  m_size;   //!< Image size
+    PixelsPtr m_pixels; //!< Pixels of the image
 };
 
 } // namespace sf
@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class InputStream;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of threads that decode images in parallel
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback invoked when an image has been loaded
+    ///
+    /// The argument is empty if the image could not be loaded.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Callback = std::function<void(std::optional<Image>)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loader and start its threads
+    ///
+    /// \param threadCount Number of decoding threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageLoader(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the images that are still queued to be
+    /// decoded, then stops the threads. Textures that were not
+    /// uploaded with `uploadTextures` are abandoned: their
+    /// futures report a `std::future_error`.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of decoding threads
+    ///
+    /// \return Number of threads of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image file for decoding
+    ///
+    /// The function returns immediately. The future becomes
+    /// ready once the file is decoded: `get()` then returns the
+    /// image, or throws `sf::Exception` if the file could not
+    /// be loaded.
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Future image
+    ///
+    /// \see `Image::loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Image> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image file for decoding, and call a function once it is loaded
+    ///
+    /// The callback is invoked from one of the decoding threads.
+    ///
+    /// \param filename Path of the image file to load
+    /// \param callback Function to call with the loaded image
+    ///
+    /// \see `Image::loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadFromFile(const std::filesystem::path& filename, Callback callback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue several image files for decoding
+    ///
+    /// \param filenames Paths of the image files to load
+    ///
+    /// \return One future per file, in the order of \a `filenames`
+    ///
+    /// \see `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::future<Image>> loadFromFiles(const std::vector<std::filesystem::path>& filenames);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image stream for decoding
+    ///
+    /// The stream is read from one of the decoding threads: it
+    /// must stay alive and must not be used until the future
+    /// is ready.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return Future image
+    ///
+    /// \see `Image::loadFromStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Image> loadFromStream(InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image file for decoding and uploading to a texture
+    ///
+    /// The file is decoded on the pool, then the image waits
+    /// until the thread that owns the OpenGL context calls
+    /// `uploadTextures`, which creates the texture. The future
+    /// throws `sf::Exception` if the file could not be loaded or
+    /// the texture could not be created.
+    ///
+    /// \param filename Path of the image file to load
+    /// \param sRgb     `true` to enable sRGB conversion, `false` to disable it
+    ///
+    /// \return Future texture
+    ///
+    /// \see `uploadTextures`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Texture> loadTextureFromFile(const std::filesystem::path& filename, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the textures of the images decoded so far
+    ///
+    /// Call this function regularly (typically once per frame)
+    /// from the thread that owns the OpenGL context. Limiting
+    /// the number of textures created per call spreads the
+    /// uploads over several frames.
+    ///
+    /// \param maxCount Maximum number of textures to create
+    ///
+    /// \return Number of textures created (or that failed to be created)
+    ///
+    /// \see `loadTextureFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t uploadTextures(std::size_t maxCount = std::numeric_limits<std::size_t>::max());
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageLoader
+/// \ingroup graphics
+///
+/// `sf::ImageLoader` decodes image files on a pool of threads,
+/// so that loading many images takes advantage of all the
+/// CPU cores instead of decoding them one after the other.
+///
+/// Results are delivered either as futures or through a
+/// callback. Images that are meant to become textures can go
+/// through an additional stage: once decoded, they wait for
+/// the thread that owns the OpenGL context to upload them with
+/// `uploadTextures`.
+///
+/// Usage example:
+/// \code
+/// sf::ImageLoader loader;
+///
+/// // Decode every image in parallel
+/// std::vector<std::future<sf::Image>> images = loader.loadFromFiles(paths);
+/// for (auto& image : images)
+///     process(image.get());
+///
+/// // Decode textures in the background while the main loop is running
+/// std::future<sf::Texture> texture = loader.loadTextureFromFile("background.png");
+/// while (window.isOpen())
+/// {
+///     loader.uploadTextures(4);
+///
+///     if (texture.valid() && texture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+///         background = texture.get();
+///
+///     ...
+/// }
+/// \endcode
+///
+/// \see `sf::Image`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -344,6 +345,93 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the draw calls of a render target
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DrawStatistics
+    {
+        std::size_t drawCalls{};   //!< Number of draw calls issued to OpenGL
+        std::size_t mergedDraws{}; //!< Number of draws appended to an already pending batch
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive calls to `draw` with
+    /// vertex arrays that share the same texture, blend mode and
+    /// stencil mode are not sent to the graphics card immediately.
+    /// Their vertices are transformed on the CPU and collected
+    /// into a single vertex stream, which is rendered with one
+    /// draw call when the render states change, when the view
+    /// changes, when the target is cleared or displayed, or when
+    /// `flush` is called explicitly.
+    ///
+    /// Line strips, draws that use a shader and draws that use
+    /// the texture of a render texture are never batched, they
+    /// flush the pending batch and are rendered immediately.
+    ///
+    /// Pending draws refer to the textures they use, which must
+    /// therefore stay alive and unmodified until the batch is
+    /// rendered, at the latest by the next `display`, `clear` or
+    /// `flush`. Shaders are never referenced by pending draws.
+    /// Call `flush` before destroying or updating such a texture,
+    /// before reading the contents of the target (for example with
+    /// `RenderTexture::getTexture` or `Texture::update`), and before
+    /// issuing OpenGL calls of your own.
+    ///
+    /// Batching is disabled by default. Disabling it flushes
+    /// the pending batch.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the draws that are pending in the current batch
+    ///
+    /// This function does nothing if batching is disabled or if
+    /// no draw is pending.
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the draw call statistics of the render target
+    ///
+    /// The counters accumulate until `resetDrawStatistics` is
+    /// called, typically once per frame.
+    ///
+    /// \return Draw call statistics
+    ///
+    /// \see `resetDrawStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const DrawStatistics& getDrawStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the draw call statistics to zero
+    ///
+    /// \see `getDrawStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetDrawStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -514,6 +602,30 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives immediately, bypassing the batch
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawImmediate(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the pending batch if possible
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \return `true` if the primitives were batched, `false` if they must be drawn immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    bool appendToBatch(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -561,13 +673,28 @@ private:
         std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending batch of pre-transformed primitives
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        std::vector<Vertex> vertices;    //!< Pre-transformed vertices waiting to be drawn
+        PrimitiveType       type{};      //!< Type of the batched primitives (points, lines or triangles)
+        RenderStates        states;      //!< Render states shared by all the batched primitives
+        std::uint64_t       textureId{}; //!< Cache identifier of the batched texture
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View           m_defaultView;       //!< Default view
+    View           m_view;              //!< Current view
+    StatesCache    m_cache{};           //!< Render states cache
+    std::uint64_t  m_id{};              //!< Unique number that identifies the RenderTarget
+    bool           m_batchingEnabled{}; //!< Are draws collected into batches?
+    Batch          m_batch;             //!< Pending batch of primitives
+    DrawStatistics m_statistics;        //!< Draw call statistics
 };
 
 } // namespace sf
@@ -262,6 +262,10 @@ public:
     /// once and keep a reference to the texture even after it is
     /// modified.
     ///
+    /// The draws still pending in the current batch (see
+    /// `RenderTarget::setBatchingEnabled`) are not part of the
+    /// texture until they are rendered by `display` or `flush`.
+    ///
     /// \return Const reference to the texture
     ///
     ////////////////////////////////////////////////////////////
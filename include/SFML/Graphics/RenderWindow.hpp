@@ -178,6 +178,20 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setActive(bool active = true) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Display on screen what has been rendered to the window so far
+    ///
+    /// This function renders the draws that are still pending
+    /// in the current batch (see `RenderTarget::setBatchingEnabled`)
+    /// and then presents the frame, like `Window::display`.
+    ///
+    /// It hides `Window::display`, which is not virtual: calling
+    /// the latter through a reference to `sf::Window` doesn't
+    /// render the pending draws, call `flush` first in that case.
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Function called after the window has been created
@@ -0,0 +1,365 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable collection of textured quads that share
+///        a single texture and are drawn in a single call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty sprite batch from a source texture
+    ///
+    /// \param texture Source texture shared by all the sprites
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the sprite batch
+    ///
+    /// The \a `texture` argument refers to a texture that must
+    /// exist as long as the sprite batch uses it. The texture
+    /// rectangles of the sprites are left unchanged.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the sprite batch
+    ///
+    /// \return Reference to the sprite batch's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite to the batch
+    ///
+    /// The new sprite has no rotation, a scale of (1, 1) and
+    /// its origin at its top-left corner.
+    ///
+    /// \param position    Position of the sprite
+    /// \param textureRect Sub-rectangle of the texture displayed by the sprite
+    /// \param color       Color of the sprite
+    ///
+    /// \return Index of the new sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(Vector2f position, const IntRect& textureRect, Color color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sprite from the batch
+    ///
+    /// The last sprite of the batch is moved into the slot of
+    /// the removed one so that removal is done in constant time.
+    /// Therefore the index of the last sprite becomes \a `index`.
+    ///
+    /// \param index Index of the sprite to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the sprites from the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve storage for a number of sprites
+    ///
+    /// \param spriteCount Number of sprites to reserve storage for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t spriteCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sprites in the batch
+    ///
+    /// \return Number of sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSpriteCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a sprite
+    ///
+    /// \param index    Index of the sprite
+    /// \param position New position
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(std::size_t index, Vector2f position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of a sprite
+    ///
+    /// \param index  Index of the sprite
+    /// \param origin New origin, relative to the top-left corner of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(std::size_t index, Vector2f origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the orientation of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param angle New rotation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(std::size_t index, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param scale New scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(std::size_t index, Vector2f scale);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture displayed by a sprite
+    ///
+    /// \param index       Index of the sprite
+    /// \param textureRect New texture rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(std::size_t index, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param color New color
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Position of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Origin of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getOrigin(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the orientation of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Rotation of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Scale factors of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getScale(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Texture rectangle of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Color of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getColor(std::size_t index) const;
+
+    // Transformable functions operating on the whole batch
+    using Transformable::getOrigin;
+    using Transformable::getPosition;
+    using Transformable::getRotation;
+    using Transformable::getScale;
+    using Transformable::setOrigin;
+    using Transformable::setPosition;
+    using Transformable::setRotation;
+    using Transformable::setScale;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprite batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the geometry of a sprite as outdated
+    ///
+    /// \param index Index of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Regenerate the vertices of the outdated sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*              m_texture;      //!< Texture of the sprites
+    std::vector<Vector2f>       m_positions;    //!< Position of each sprite
+    std::vector<Vector2f>       m_origins;      //!< Origin of each sprite
+    std::vector<Angle>          m_rotations;    //!< Rotation of each sprite
+    std::vector<Vector2f>       m_scales;       //!< Scale factors of each sprite
+    std::vector<IntRect>        m_textureRects; //!< Texture rectangle of each sprite
+    std::vector<Color>          m_colors;       //!< Color of each sprite
+    mutable std::vector<bool>   m_dirty;        //!< Does the geometry of each sprite need an update?
+    mutable std::size_t         m_dirtyBegin{}; //!< Index of the first outdated sprite
+    mutable std::size_t         m_dirtyEnd{};   //!< Index past the last outdated sprite
+    mutable std::vector<Vertex> m_vertices;     //!< Vertices of all the sprites, 6 per sprite
+    mutable VertexBuffer        m_vertexBuffer; //!< Vertices of the sprites stored on the graphics card
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// `sf::SpriteBatch` is a drawable class that displays many
+/// textured quads sharing the same texture, such as particles
+/// or map tiles, with a single draw call.
+///
+/// Each sprite of the batch has its own position, origin,
+/// rotation, scale, texture rectangle and color. These
+/// properties are stored in separate arrays and only the
+/// sprites whose properties changed since the last draw get
+/// their vertices regenerated. The vertices are kept in a
+/// `sf::VertexBuffer` when available, so that only the modified
+/// range is uploaded to the graphics card.
+///
+/// Sprites are identified by their index in the batch. Since
+/// `remove` moves the last sprite into the removed slot, indices
+/// are stable only as long as no sprite is removed.
+///
+/// The batch as a whole is also a `sf::Transformable`, its
+/// transform is applied on top of the transform of each sprite.
+///
+/// Like `sf::Sprite`, `sf::SpriteBatch` doesn't copy the texture
+/// that it uses, it only keeps a reference to it.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture texture("particles.png");
+///
+/// sf::SpriteBatch batch(texture);
+/// for (int i = 0; i < 10000; ++i)
+///     batch.add({float(i % 100) * 8.f, float(i / 100) * 8.f}, {{0, 0}, {8, 8}});
+///
+/// batch.setColor(42, sf::Color::Red);
+///
+/// window.draw(batch);
+/// \endcode
+///
+/// \see `sf::Sprite`, `sf::Texture`, `sf::VertexBuffer`
+///
+////////////////////////////////////////////////////////////
@@ -40,6 +40,8 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -106,13 +108,59 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// Only the lines starting from the first character that differs
+    /// from the previous string are laid out again, so replacing a
+    /// long string by a slightly modified version is cheap.
+    ///
     /// \param string New string
     ///
-    /// \see `getString`
+    /// \see `getString`, `append`, `insert`, `erase`
     ///
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append characters at the end of the text's string
+    ///
+    /// Only the last line of the text is laid out again, which
+    /// makes this function suitable for texts that grow a little
+    /// bit at a time, like consoles or chat logs.
+    ///
+    /// \param string Characters to append
+    ///
+    /// \see `insert`, `erase`, `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert characters into the text's string
+    ///
+    /// Only the lines starting from the one containing the
+    /// insertion point are laid out again.
+    ///
+    /// \param position Position of insertion, must not be greater than the string's size
+    /// \param string   Characters to insert
+    ///
+    /// \see `append`, `erase`, `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void insert(std::size_t position, const String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Erase characters from the text's string
+    ///
+    /// Only the lines starting from the one containing the
+    /// first erased character are laid out again.
+    ///
+    /// \param position Position of the first character to erase, must not be greater than the string's size
+    /// \param count    Number of characters to erase
+    ///
+    /// \see `append`, `insert`, `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void erase(std::size_t position, std::size_t count = 1);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -355,6 +403,10 @@ public:
     /// If \a `index` is out of range, the position of the end of
     /// the string is returned.
     ///
+    /// The positions of all the characters are computed along
+    /// with the geometry of the text, so this function doesn't
+    /// have to walk the string again.
+    ///
     /// \param index Index of the character
     ///
     /// \return Position of the character
@@ -409,23 +461,47 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Layout information recorded at the start of each line
+    ///
+    /// It allows laying out the text again from any line,
+    /// instead of from the start of the string.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Line
+    {
+        std::size_t              firstCharacter{};           //!< Index of the first character of the line
+        std::size_t              vertexCount{};              //!< Number of fill vertices of the previous lines
+        std::size_t              outlineVertexCount{};       //!< Number of outline vertices of the previous lines
+        std::vector<std::size_t> spilledVertexCounts;        //!< Number of fill vertices of the previous lines in each of the other font textures
+        std::vector<std::size_t> spilledOutlineVertexCounts; //!< Number of outline vertices of the previous lines in each of the other font textures
+        float                    y{};                        //!< Y position of the baseline of the line
+        Vector2f                 min;                        //!< Minimum coordinates of the previous lines
+        Vector2f                 max;                        //!< Maximum coordinates of the previous lines
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String                m_string;                                    //!< String to display
-    const Font*           m_font{};                                    //!< Font used to display the string
-    unsigned int          m_characterSize{30};                         //!< Base size of characters, in pixels
-    float                 m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
-    float                 m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
-    std::uint32_t         m_style{Regular};                            //!< Text style (see Style enum)
-    Color                 m_fillColor{Color::White};                   //!< Text fill color
-    Color                 m_outlineColor{Color::Black};                //!< Text outline color
-    float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
-    mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
-    mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    String                             m_string;                                    //!< String to display
+    const Font*                        m_font{};                                    //!< Font used to display the string
+    unsigned int                       m_characterSize{30};                         //!< Base size of characters, in pixels
+    float                              m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
+    float                              m_lineSpacingFactor{1.f};                    //!< Spacing factor between lines
+    std::uint32_t                      m_style{Regular};                            //!< Text style (see Style enum)
+    Color                              m_fillColor{Color::White};                   //!< Text fill color
+    Color                              m_outlineColor{Color::Black};                //!< Text outline color
+    float                              m_outlineThickness{0.f};                     //!< Thickness of the text's outline
+    mutable VertexArray                m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
+    mutable VertexArray                m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
+    mutable std::vector<VertexArray>   m_spilledVertices;                           //!< Fill geometry of the glyphs in the other font textures
+    mutable std::vector<VertexArray>   m_spilledOutlineVertices;                    //!< Outline geometry of the glyphs in the other font textures
+    mutable FloatRect                  m_bounds;                                    //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool                       m_geometryNeedUpdate{};                      //!< Does the geometry need to be recomputed?
+    mutable std::size_t                m_layoutStart{String::InvalidPos};           //!< Index of the first character to lay out again after an edit of the string
+    mutable std::vector<Line>          m_lines;                                     //!< Layout information of each line
+    mutable std::vector<Vector2f>      m_characterPositions;                        //!< Pen position before each character, and at the end of the string
+    mutable std::vector<std::uint64_t> m_fontTextureIds;                            //!< The ids of the font textures
 };
 
 } // namespace sf
@@ -37,6 +37,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
+#include <memory>
 
 #include <cstddef>
 #include <cstdint>
@@ -47,6 +48,7 @@ namespace sf
 class InputStream;
 class Window;
 class Image;
+class TextureReadback;
 
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
@@ -402,6 +404,27 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture pixels to an image, without waiting for the transfer
+    ///
+    /// Unlike `copyToImage`, this function doesn't stall until
+    /// the graphics card has finished rendering to the texture:
+    /// it queues a transfer into a pixel buffer and returns
+    /// immediately. Poll the returned handle with
+    /// `TextureReadback::isReady` (typically once per frame) and
+    /// call `TextureReadback::getImage` to retrieve the pixels.
+    ///
+    /// If pixel buffers, sync objects or framebuffer objects
+    /// are not supported, the pixels are copied immediately
+    /// and the returned handle is ready right away.
+    ///
+    /// \return Handle to the pending copy
+    ///
+    /// \see `copyToImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback copyToImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
@@ -530,6 +553,11 @@ public:
     /// This function does nothing if either the texture or the window
     /// was not previously created.
     ///
+    /// The draws of a `sf::RenderWindow` that are still pending in
+    /// its batch are not part of the copied contents: call
+    /// `RenderTarget::flush` before copying from a render window
+    /// that has batching enabled (see `RenderTarget::setBatchingEnabled`).
+    ///
     /// \param window Window to copy to the texture
     ///
     ////////////////////////////////////////////////////////////
@@ -545,12 +573,84 @@ public:
     /// This function does nothing if either the texture or the window
     /// was not previously created.
     ///
+    /// The draws of a `sf::RenderWindow` that are still pending in
+    /// its batch are not part of the copied contents: call
+    /// `RenderTarget::flush` before copying from a render window
+    /// that has batching enabled (see `RenderTarget::setBatchingEnabled`).
+    ///
     /// \param window Window to copy to the texture
     /// \param dest   Coordinates of the destination position
     ///
     ////////////////////////////////////////////////////////////
     void update(const Window& window, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels, without waiting for the upload
+    ///
+    /// This function does the same as `update`, but the pixels
+    /// are first copied to one of a few pixel buffer objects
+    /// owned by the texture, from which the graphics driver
+    /// uploads them in the background. The call returns as soon
+    /// as the pixels are copied, so \a `pixels` can be reused
+    /// immediately, and drawing the texture afterwards sees the
+    /// new pixels.
+    ///
+    /// Successive calls cycle through the pixel buffers. When a
+    /// buffer is still being read by a previous upload, which the
+    /// texture checks with a fence, it is given new storage rather
+    /// than waited for. This makes the function well suited to
+    /// streaming video frames or tiles into a texture every frame.
+    ///
+    /// If the system doesn't support pixel buffer objects and
+    /// fences, this function falls back to `update`.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in \a `pixels`
+    /// \param dest   Coordinates of the destination position
+    ///
+    /// \see `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an image, without waiting for the upload
+    ///
+    /// See `updateAsync(const std::uint8_t*, Vector2u, Vector2u)`.
+    ///
+    /// \param image Image to copy to the texture
+    /// \param dest  Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAsync(const Image& image, Vector2u dest = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable flushing the OpenGL commands after each update
+    ///
+    /// When enabled, every `update`, `updateAsync` and
+    /// `loadFromImage` call ends with a `glFlush`, so that the new
+    /// pixels are visible right away in the other OpenGL contexts,
+    /// for example when the texture is drawn from another thread.
+    /// Flushing is costly when the texture is updated often, so
+    /// it is disabled by default.
+    ///
+    /// \param flush `true` to flush after each update, `false` to disable it
+    ///
+    /// \see `isFlushedOnUpdate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFlushedOnUpdate(bool flush);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the OpenGL commands are flushed after each update
+    ///
+    /// \return `true` if each update is flushed, `false` if not
+    ///
+    /// \see `setFlushedOnUpdate`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFlushedOnUpdate() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
     ///
@@ -715,6 +815,7 @@ private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureReadback;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -740,6 +841,26 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the pixels of the texture through a framebuffer object
+    ///
+    /// Only the public area of the texture is read, as tightly
+    /// packed rows in OpenGL's bottom-up order. When a pixel pack
+    /// buffer is bound, \a pixels is an offset into that buffer.
+    /// The framebuffer extension must be available.
+    ///
+    /// \param pixels Destination of the pixels
+    ///
+    /// \return `true` if the pixels were read, `false` if no complete framebuffer could be created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readPixels(std::uint8_t* pixels) const;
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct UploadBuffers;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -752,7 +873,10 @@ private:
     mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
     bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool          m_hasMipmap{};     //!< Has the mipmap been generated?
+    bool          m_flushOnUpdate{}; //!< Should each update be followed by a glFlush?
     std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+
+    std::unique_ptr<UploadBuffers> m_uploadBuffers; //!< Pixel buffers used by updateAsync, created on first use
 };
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <memory>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pending copy of a texture's pixels to an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty readback, which yields an empty image.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Releases the pixel buffer if the image was never retrieved.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels have arrived
+    ///
+    /// This function never blocks. Once it returns `true`,
+    /// `getImage` returns without waiting for the graphics card.
+    ///
+    /// \return `true` if the copy is complete (or if there is nothing to copy)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the copied pixels
+    ///
+    /// If the copy is not complete yet, this function waits
+    /// for it. The pixel buffer is released afterwards, so the
+    /// image can be retrieved only once: subsequent calls
+    /// return an empty image.
+    ///
+    /// \return Image containing the texture's pixels
+    ///
+    /// \see `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image getImage();
+
+private:
+    friend class Texture;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the pixels of a texture
+    ///
+    /// \param texture Texture to read
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureReadback(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// `sf::TextureReadback` is the handle returned by
+/// `sf::Texture::copyToImageAsync`. Reading a texture back
+/// with `sf::Texture::copyToImage` stalls the CPU until the
+/// graphics card has executed every pending command and the
+/// pixels have been transferred. With a readback, the transfer
+/// is queued into a pixel buffer and the application can keep
+/// working (or rendering the next frames) until it completes.
+///
+/// Usage example:
+/// \code
+/// std::optional<sf::TextureReadback> readback;
+///
+/// while (window.isOpen()) // the main loop
+/// {
+///     ...
+///
+///     // request a screenshot of the render texture
+///     if (!readback)
+///         readback = renderTexture.getTexture().copyToImageAsync();
+///
+///     // save it once it has arrived, without stalling the frame
+///     if (readback && readback->isReady())
+///     {
+///         (void)readback->getImage().saveToFile("screenshot.png");
+///         readback.reset();
+///     }
+///
+///     ...
+/// }
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::Image`
+///
+////////////////////////////////////////////////////////////
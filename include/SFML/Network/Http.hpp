@@ -38,6 +38,9 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <vector>
+
+#include <cstddef>
 
 
 namespace sf
@@ -297,29 +300,6 @@ public:
     private:
         friend class Http;
 
-        ////////////////////////////////////////////////////////////
-        /// \brief Construct the header from a response string
-        ///
-        /// This function is used by `Http` to build the response
-        /// of a request.
-        ///
-        /// \param data Content of the response to parse
-        ///
-        ////////////////////////////////////////////////////////////
-        void parse(const std::string& data);
-
-
-        ////////////////////////////////////////////////////////////
-        /// \brief Read values passed in the answer header
-        ///
-        /// This function is used by `Http` to extract values passed
-        /// in the response.
-        ///
-        /// \param in String stream containing the header values
-        ///
-        ////////////////////////////////////////////////////////////
-        void parseFields(std::istream& in);
-
         ////////////////////////////////////////////////////////////
         // Types
         ////////////////////////////////////////////////////////////
@@ -397,6 +377,10 @@ public:
     /// application, or use a timeout to limit the time to wait. A value
     /// of `Time::Zero` means that the client will use the system default timeout
     /// (which is usually pretty long).
+    /// If the connection is lost before the whole body has been
+    /// received, the status of the response is
+    /// `Response::Status::ConnectionFailed` and its body holds
+    /// what was received so far.
     ///
     /// \param request Request to send
     /// \param timeout Maximum time to wait
@@ -406,7 +390,79 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the body of the response
+    ///
+    /// This function works like `sendRequest(const Request&, Time)`,
+    /// except that the body of the response is written to \a `body`
+    /// as it is received, instead of being stored in the response
+    /// (`getBody()` then returns an empty string). This is the
+    /// way to download big resources without keeping them in memory.
+    ///
+    /// \param request Request to send
+    /// \param body    Stream to write the body of the response to
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return Server's response, without its body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request& request, std::ostream& body, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests at once and return the server's responses
+    ///
+    /// The requests are pipelined: they are all sent before
+    /// waiting for the first response, which saves a round trip
+    /// to the server per request. This requires HTTP/1.1 requests
+    /// (see `Request::setHttpVersion`) and a server that keeps
+    /// the connection alive; if the server closes the connection
+    /// early, the requests left are sent again on a new connection.
+    /// Since they may have been processed already, only pipeline
+    /// requests that can safely be repeated (like GET requests).
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait for each connection
+    ///
+    /// \return Server's responses, in the same order as \a `requests`
+    ///
+    /// \see `sendRequest`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(const std::vector<Request>& requests, Time timeout = Time::Zero);
+
 private:
+    class ResponseParser;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the missing mandatory header fields to a request
+    ///
+    /// \param request Request to complete
+    ///
+    /// \return Request ready to be sent to the host
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Request completeRequest(const Request& request) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send requests through the connection and receive their responses
+    ///
+    /// The connection is opened if it isn't already, and kept
+    /// open afterwards if the server allows it.
+    ///
+    /// \param requests  Requests to send
+    /// \param responses Responses to fill, one per request
+    /// \param body      Stream receiving the bodies, or `nullptr` to store them in the responses
+    /// \param timeout   Maximum time to wait for the connection
+    ///
+    /// \return Number of responses received completely, from the first one
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t exchange(const Request* requests,
+                         Response*      responses,
+                         std::size_t    count,
+                         std::ostream*  body,
+                         Time           timeout);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -414,6 +470,7 @@ private:
     std::optional<IpAddress> m_host;       //!< Web host address
     std::string              m_hostName;   //!< Web host name
     unsigned short           m_port{};     //!< Port used for connection with host
+    std::string              m_received;   //!< Data received after the last response (start of a pipelined response)
 };
 
 } // namespace sf
@@ -451,6 +508,12 @@ private:
 /// `sf::Http::Request` and return the corresponding `sf::Http::Response`
 /// from the server.
 ///
+/// With HTTP/1.1 requests, the connection to the server is kept
+/// alive between requests, so that a series of requests doesn't
+/// pay for a new connection each time; `sendRequests` even sends
+/// them all at once. Big responses can be streamed to a
+/// `std::ostream` rather than stored in memory.
+///
 /// Usage example:
 /// \code
 /// // Create a new HTTP client
@@ -38,6 +38,7 @@
 
 namespace sf
 {
+class PacketPool;
 class String;
 
 ////////////////////////////////////////////////////////////
@@ -56,35 +57,65 @@ public:
     ////////////////////////////////////////////////////////////
     Packet() = default;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packet that borrows its buffer from a pool
+    ///
+    /// The buffer is given back to the pool when the packet is
+    /// destroyed, so the pool must remain alive as long as the
+    /// packet uses it.
+    ///
+    /// \param pool Pool to borrow the buffer from
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Packet(PacketPool& pool);
+
     ////////////////////////////////////////////////////////////
     /// \brief Virtual destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~Packet() = default;
+    virtual ~Packet();
 
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
+    /// The copy borrows its buffer from the same pool as \a `packet`, if any.
+    ///
     ////////////////////////////////////////////////////////////
-    Packet(const Packet&) = default;
+    Packet(const Packet& packet);
 
     ////////////////////////////////////////////////////////////
     /// \brief Copy assignment
     ///
+    /// The packet keeps its own buffer, only the data is copied.
+    ///
     ////////////////////////////////////////////////////////////
-    Packet& operator=(const Packet&) = default;
+    Packet& operator=(const Packet& packet);
 
     ////////////////////////////////////////////////////////////
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    Packet(Packet&&) noexcept = default;
+    Packet(Packet&& packet) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    Packet& operator=(Packet&&) noexcept = default;
+    Packet& operator=(Packet&& packet) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for the data of the packet
+    ///
+    /// This avoids reallocations when the data is appended
+    /// piece by piece. The memory is kept when the packet is
+    /// cleared.
+    ///
+    /// \param sizeInBytes Number of bytes that the packet can hold without reallocating
+    ///
+    /// \see `append`
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t sizeInBytes);
 
     ////////////////////////////////////////////////////////////
     /// \brief Append data to the end of the packet
@@ -364,6 +395,134 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the packet
+    ///
+    /// This is equivalent to reading the values one by one with
+    /// `operator>>`, but much faster for big arrays: the values
+    /// are checked, copied and converted from the network byte
+    /// order all at once. If the packet doesn't contain enough
+    /// data, nothing is read and the packet becomes invalid.
+    ///
+    /// \param data  Array to fill with the values
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet, to check whether the values were extracted successfully
+    ///
+    /// \see `writeArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values to the packet
+    ///
+    /// This is equivalent to writing the values one by one with
+    /// `operator<<`, but much faster for big arrays: the values
+    /// are converted to the network byte order and appended all
+    /// at once. The number of values is not written, so it must
+    /// be known by the receiver (or written separately).
+    ///
+    /// \param data  Array of values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const double* data, std::size_t count);
+
 protected:
     friend class TcpSocket;
     friend class UdpSocket;
@@ -408,6 +567,52 @@ protected:
     virtual void onReceive(const void* data, std::size_t size);
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read integers stored in the network byte order
+    ///
+    /// \param data  Array to fill with the values
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& readValues(T* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write integers in the network byte order
+    ///
+    /// \param data  Array of values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& writeValues(const T* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read characters stored as 32-bit integers
+    ///
+    /// The size of the data must have been checked before.
+    ///
+    /// \param data   Array to fill with the characters
+    /// \param length Number of characters to read
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Char>
+    void readCharacters(Char* data, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write characters as 32-bit integers
+    ///
+    /// \param data   Array of characters to write
+    /// \param length Number of characters to write
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Char>
+    void writeCharacters(const Char* data, std::size_t length);
+
     ////////////////////////////////////////////////////////////
     /// \brief Check if the packet can extract a given number of bytes
     ///
@@ -427,6 +632,7 @@ private:
     std::size_t            m_readPos{};     //!< Current reading position in the packet
     std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
     bool                   m_isValid{true}; //!< Reading state of the packet
+    PacketPool*            m_pool{};        //!< Pool that lent the buffer of the packet, if any
 };
 
 } // namespace sf
@@ -490,6 +696,10 @@ private:
 /// \li floating point numbers (`float`, `double`)
 /// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::String`)
 ///
+/// Arrays of integers and floating point numbers can be written
+/// and read in a single call with `writeArray` and `readArray`,
+/// which is much faster than a loop over the stream operators.
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Thread-safe pool of buffers that packets can
+///        borrow instead of allocating their own
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the use of a pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t allocatedBuffers{}; //!< Number of buffers allocated by the pool since its creation
+        std::size_t freeBuffers{};      //!< Number of buffers currently waiting in the pool to be borrowed
+        std::size_t borrowedBuffers{};  //!< Number of buffers currently borrowed by packets
+        std::size_t reusedBuffers{};    //!< Number of times a buffer was borrowed without having to be allocated
+        std::size_t discardedBuffers{}; //!< Number of buffers freed when given back to a full pool or too big
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool
+    ///
+    /// \param bufferCapacity Number of bytes reserved in each buffer of the pool
+    /// \param maxFreeBuffers Maximum number of free buffers that the pool keeps for reuse
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PacketPool(std::size_t bufferCapacity = 1024, std::size_t maxFreeBuffers = 256);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PacketPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketPool(const PacketPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketPool& operator=(const PacketPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate free buffers in advance
+    ///
+    /// This avoids allocations when packets are first created,
+    /// for example at the start of a busy period. The number
+    /// of free buffers never exceeds the maximum given to the
+    /// constructor.
+    ///
+    /// \param count Number of free buffers to have in the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes reserved in each buffer of the pool
+    ///
+    /// \return Capacity of the buffers, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBufferCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters describing the use of the pool
+    ///
+    /// This is useful to choose the capacity and the number
+    /// of buffers of the pool for a given application.
+    ///
+    /// \return Current statistics of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    friend class Packet;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Borrow a buffer from the pool
+    ///
+    /// \return Empty buffer, with at least the capacity of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::byte> acquire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a borrowed buffer back to the pool
+    ///
+    /// \param buffer Buffer to give back
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(std::vector<std::byte>&& buffer);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketPool
+/// \ingroup network
+///
+/// Every `sf::Packet` normally owns its own buffer, which is
+/// allocated when data is first written to it and freed when
+/// the packet is destroyed. When an application creates and
+/// destroys many packets per second, this makes a lot of
+/// allocations that are not needed.
+///
+/// Packets constructed from a `sf::PacketPool` borrow their
+/// buffer from the pool instead, and give it back when they
+/// are destroyed, so that the next packets can reuse it. The
+/// buffers keep their memory when packets are cleared, so
+/// that receiving into the same packet again doesn't allocate
+/// either. Buffers that grew to more than 4 times the capacity
+/// of the pool are freed instead of being kept, so that a few
+/// big packets don't hold memory forever. A pool can be shared
+/// by packets used in different threads.
+///
+/// The pool must remain alive as long as packets borrow its
+/// buffers.
+///
+/// Usage example:
+/// \code
+/// // Create a pool of buffers of 512 bytes, and allocate 100 of them right now
+/// sf::PacketPool pool(512);
+/// pool.reserve(100);
+///
+/// while (running)
+/// {
+///     sf::Packet packet(pool);
+///     if (socket.receive(packet) == sf::Socket::Status::Done)
+///         process(packet);
+/// } // the buffer of the packet goes back to the pool here
+///
+/// // Check how well the pool is sized
+/// const sf::PacketPool::Statistics statistics = pool.getStatistics();
+/// std::cout << statistics.reusedBuffers << " buffers reused, "
+///           << statistics.allocatedBuffers << " buffers allocated" << std::endl;
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
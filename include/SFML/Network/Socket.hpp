@@ -180,15 +180,30 @@ protected:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the socket holds received data that
+    ///        the system doesn't know about anymore
+    ///
+    /// Sockets that read ahead of what the user asked for call
+    /// this function when such data arrives and once it has
+    /// been consumed, so that selectors still report them as
+    /// ready while they have unconsumed data.
+    ///
+    /// \param hasBufferedData `true` if a receive would return buffered data immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    void setHasBufferedData(bool hasBufferedData);
+
 private:
     friend class SocketSelector;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Type         m_type;             //!< Type of the socket (TCP or UDP)
-    SocketHandle m_socket;           //!< Socket descriptor
-    bool         m_isBlocking{true}; //!< Current blocking mode of the socket
+    Type         m_type;                   //!< Type of the socket (TCP or UDP)
+    SocketHandle m_socket;                 //!< Socket descriptor
+    bool         m_isBlocking{true};       //!< Current blocking mode of the socket
+    bool         m_hasBufferedData{false}; //!< Does the socket hold data received ahead?
 };
 
 } // namespace sf
@@ -32,6 +32,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace sf
@@ -140,7 +141,7 @@ public:
     ///
     /// \return `true` if there are sockets ready, `false` otherwise
     ///
-    /// \see `isReady`
+    /// \see `isReady`, `getReadySockets`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool wait(Time timeout = Time::Zero);
@@ -164,6 +165,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sockets that are ready to receive data
+    ///
+    /// This function must be used after a call to `wait`. It
+    /// returns the sockets for which `isReady` returns `true`,
+    /// so that a selector holding a lot of sockets doesn't have
+    /// to test each of them.
+    ///
+    /// \return Sockets that are ready to receive data, in no particular order
+    ///
+    /// \see `wait`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Socket*>& getReadySockets() const;
+
 private:
     struct SocketSelectorImpl;
 
@@ -193,6 +209,12 @@ private:
 /// \li `sf::TcpSocket`
 /// \li `sf::UdpSocket`
 ///
+/// On Linux, selectors are implemented with epoll: waiting
+/// costs as much as the number of ready sockets rather than
+/// the number of sockets in the selector, and there is no
+/// limit on the number of sockets. Other systems use `select`,
+/// which is limited to `FD_SETSIZE` sockets.
+///
 /// A selector doesn't store its own copies of the sockets
 /// (socket classes are not copyable anyway), it simply keeps
 /// a reference to the original sockets that you pass to the
@@ -203,7 +225,7 @@ private:
 /// Using a selector is simple:
 /// \li populate the selector with all the sockets that you want to observe
 /// \li make it wait until there is data available on any of the sockets
-/// \li test each socket to find out which ones are ready
+/// \li test each socket to find out which ones are ready, or get the ready ones with `getReadySockets`
 ///
 /// Usage example:
 /// \code
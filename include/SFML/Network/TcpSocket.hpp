@@ -34,6 +34,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include <cstddef>
@@ -167,6 +168,8 @@ public:
     ///
     /// In blocking mode, this function will wait until some
     /// bytes are actually received.
+    /// Data that `receive(Packet&)` has already read ahead is
+    /// returned first, without waiting.
     /// This function will fail if the socket is not connected.
     ///
     /// \param data     Pointer to the array to fill with the received bytes
@@ -198,11 +201,38 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets of data to the remote peer
+    ///
+    /// The packets are sent in order, with as few system calls
+    /// as possible. This is more efficient than sending them one
+    /// by one when there are a lot of small packets to send.
+    ///
+    /// In non-blocking mode, if this function returns `sf::Socket::Status::Partial`,
+    /// you \em must retry sending the same unmodified packets, in
+    /// the same order, before sending anything else. Packets that
+    /// were already completely sent are not sent again.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \param packets Packets to send
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const std::vector<Packet*>& packets);
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
     /// In blocking mode, this function will wait until the whole packet
     /// has been received.
+    /// The socket reads as much data as the system has available
+    /// and keeps what follows the packet for the next calls, so
+    /// that receiving many small packets doesn't cost a system
+    /// call each. Selectors report the socket as ready as long
+    /// as such data is left.
     /// This function will fail if the socket is not connected.
     ///
     /// \param packet Packet to fill with the received data
@@ -217,6 +247,30 @@ public:
 private:
     friend class TcpListener;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the read-ahead buffer holds unconsumed data
+    ///
+    /// \return `true` if some received data is waiting in the read-ahead buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasBufferedData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Consume bytes at the start of the read-ahead buffer
+    ///
+    /// \param count Number of bytes consumed
+    ///
+    ////////////////////////////////////////////////////////////
+    void consumeReceiveBuffer(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive as much data as available into the empty read-ahead buffer
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status fillReceiveBuffer();
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure holding the data of a pending packet
     ///
@@ -228,11 +282,47 @@ private:
         std::vector<std::byte> data;           //!< Data of the packet
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure holding the data received ahead of the packets
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ReceiveBuffer
+    {
+        ReceiveBuffer() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor, leaves \a `other` empty
+        ///
+        ////////////////////////////////////////////////////////////
+        ReceiveBuffer(ReceiveBuffer&& other) noexcept :
+        data(std::move(other.data)),
+        begin(std::exchange(other.begin, 0)),
+        end(std::exchange(other.end, 0))
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment, leaves \a `other` empty
+        ///
+        ////////////////////////////////////////////////////////////
+        ReceiveBuffer& operator=(ReceiveBuffer&& other) noexcept
+        {
+            data  = std::move(other.data);
+            begin = std::exchange(other.begin, 0);
+            end   = std::exchange(other.end, 0);
+            return *this;
+        }
+
+        std::vector<std::byte> data;    //!< Storage of the received data (allocated on first use)
+        std::size_t            begin{}; //!< Position of the first unconsumed byte
+        std::size_t            end{};   //!< Position after the last received byte
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    PendingPacket m_pendingPacket; //!< Temporary data of the packet currently being received
+    ReceiveBuffer m_receiveBuffer; //!< Data received from the system but not consumed yet
 };
 
 } // namespace sf
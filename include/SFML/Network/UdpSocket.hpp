@@ -55,6 +55,17 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Packet exchanged with a remote peer, as part of a batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        Packet*                  packet{};        //!< Packet to send, or to fill with the received data
+        std::optional<IpAddress> remoteAddress{}; //!< Address of the receiver, or of the peer that sent the data
+        unsigned short           remotePort{};    //!< Port of the receiver, or of the peer that sent the data
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,11 +205,61 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a batch of formatted packets to remote peers
+    ///
+    /// Each datagram is sent to its own receiver. Where the
+    /// system supports it, many datagrams are handed over in
+    /// a single system call, which is much cheaper than sending
+    /// them one by one when there are a lot of small packets.
+    ///
+    /// Every datagram must have a packet and a receiver, otherwise
+    /// this function fails and no data is sent. A packet bigger
+    /// than `UdpSocket::MaxDatagramSize` makes this function fail
+    /// too, after the datagrams before it have been sent.
+    ///
+    /// In non-blocking mode, `sf::Socket::Status::Partial` is
+    /// returned if only the first \a `sent` datagrams could be
+    /// sent; the rest can be sent by another call later.
+    ///
+    /// \param datagrams Packets to send, with their receivers
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const std::vector<Datagram>& datagrams, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a batch of formatted packets from remote peers
+    ///
+    /// The packets of the datagrams are filled in order, along
+    /// with the address and port of their sender, up to the size
+    /// of \a `datagrams` (the packets must be set beforehand).
+    /// Where the system supports it, many datagrams are received
+    /// in a single system call.
+    ///
+    /// In blocking mode, this function waits until at least one
+    /// datagram has been received, then it only takes the ones
+    /// that are already queued without waiting for more.
+    ///
+    /// \param datagrams Datagrams to fill with the received data
+    /// \param received  This variable is filled with the number of datagrams received
+    ///
+    /// \return Status code
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(std::vector<Datagram>& datagrams, std::size_t& received);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet)
+    std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet) (grown for batches)
 };
 
 } // namespace sf
@@ -288,6 +349,23 @@ private:
 /// socket.send(message.c_str(), message.size() + 1, sender, port);
 /// \endcode
 ///
+/// When there are many small datagrams to exchange, they can
+/// be sent and received in batches of `sf::UdpSocket::Datagram`,
+/// which saves a lot of system calls:
+/// \code
+/// std::vector<sf::Packet> packets(64);
+/// std::vector<sf::UdpSocket::Datagram> datagrams;
+/// for (sf::Packet& packet : packets)
+///     datagrams.push_back({&packet});
+///
+/// std::size_t received = 0;
+/// if (socket.receive(datagrams, received) == sf::Socket::Status::Done)
+/// {
+///     for (std::size_t i = 0; i < received; ++i)
+///         handle(*datagrams[i].packet, *datagrams[i].remoteAddress, datagrams[i].remotePort);
+/// }
+/// \endcode
+///
 /// \see `sf::Socket`, `sf::TcpSocket`, `sf::Packet`
 ///
 ////////////////////////////////////////////////////////////
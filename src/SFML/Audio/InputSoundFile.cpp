@@ -311,6 +311,19 @@ std::uint64_t InputSoundFile::read(std::int16_t* samples, std::uint64_t maxCount
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_reader);
+
+    std::uint64_t readSamples = 0;
+    if (samples && maxCount)
+        readSamples = m_reader->readFloat(samples, maxCount);
+    m_sampleOffset += readSamples;
+    return readSamples;
+}
+
+
 ////////////////////////////////////////////////////////////
 void InputSoundFile::close()
 {
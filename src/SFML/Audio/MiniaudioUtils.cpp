@@ -376,6 +376,20 @@ SoundChannel MiniaudioUtils::miniaudioChannelToSoundChannel(ma_channel soundChan
 }
 
 
+////////////////////////////////////////////////////////////
+ma_format MiniaudioUtils::sampleFormatToMiniaudioFormat(SampleFormat sampleFormat)
+{
+    switch (sampleFormat)
+    {
+        case SampleFormat::Float32:
+            return ma_format_f32;
+        default:
+            assert(sampleFormat == SampleFormat::Int16);
+            return ma_format_s16;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 Time MiniaudioUtils::getPlayingOffset(ma_sound& sound)
 {
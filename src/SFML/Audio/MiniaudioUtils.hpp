@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
@@ -104,6 +105,7 @@ struct SoundBase
 
 [[nodiscard]] ma_channel   soundChannelToMiniaudioChannel(SoundChannel soundChannel);
 [[nodiscard]] SoundChannel miniaudioChannelToSoundChannel(ma_channel soundChannel);
+[[nodiscard]] ma_format    sampleFormatToMiniaudioFormat(SampleFormat sampleFormat);
 [[nodiscard]] Time         getPlayingOffset(ma_sound& sound);
 [[nodiscard]] ma_uint64    getFrameIndex(ma_sound& sound, Time timeOffset);
 
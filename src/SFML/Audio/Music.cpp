@@ -33,8 +33,71 @@
 #include <SFML/System/Time.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
 #include <mutex>
 #include <ostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Samples in the format the music is streamed in
+////////////////////////////////////////////////////////////
+class SampleBuffer
+{
+public:
+    void assign(sf::SampleFormat format, std::size_t count)
+    {
+        m_format = format;
+        m_int16Samples.assign(format == sf::SampleFormat::Int16 ? count : 0, 0);
+        m_floatSamples.assign(format == sf::SampleFormat::Float32 ? count : 0, 0.f);
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_format == sf::SampleFormat::Float32 ? m_floatSamples.size() : m_int16Samples.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] std::uint64_t read(sf::InputSoundFile& file, std::size_t offset, std::size_t count)
+    {
+        if (m_format == sf::SampleFormat::Float32)
+            return file.readFloat(m_floatSamples.data() + offset, count);
+
+        return file.read(m_int16Samples.data() + offset, count);
+    }
+
+    void silence(std::size_t count)
+    {
+        std::fill_n(m_int16Samples.begin(), std::min(count, m_int16Samples.size()), std::int16_t{0});
+        std::fill_n(m_floatSamples.begin(), std::min(count, m_floatSamples.size()), 0.f);
+    }
+
+    void lend(sf::SoundStream::Chunk& data, std::size_t offset, std::size_t count) const
+    {
+        const bool isFloat = m_format == sf::SampleFormat::Float32;
+
+        data.samples      = isFloat ? nullptr : m_int16Samples.data() + offset;
+        data.floatSamples = isFloat ? m_floatSamples.data() + offset : nullptr;
+        data.sampleCount  = count;
+    }
+
+private:
+    sf::SampleFormat          m_format{sf::SampleFormat::Int16}; //!< Format of the samples in use
+    std::vector<std::int16_t> m_int16Samples;                    //!< Samples, when streaming 16-bit integers
+    std::vector<float>        m_floatSamples;                    //!< Samples, when streaming floats
+};
+} // namespace
 
 
 namespace sf
@@ -42,20 +105,265 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct Music::Impl
 {
-    InputSoundFile            file;     //!< The streamed music file
-    std::vector<std::int16_t> samples;  //!< Temporary buffer of samples
-    std::recursive_mutex      mutex;    //!< Mutex protecting the data
-    Span<std::uint64_t>       loopSpan; //!< Loop Range Specifier
+    // Marks an unset position in the decode-ahead ring
+    static constexpr std::uint64_t noPosition = std::numeric_limits<std::uint64_t>::max();
 
-    void initialize()
+    ~Impl()
+    {
+        stopDecoder();
+    }
+
+    void initialize(SampleFormat sampleFormat)
     {
         // Compute the music positions
         loopSpan.offset = 0;
         loopSpan.length = file.getSampleCount();
 
         // Resize the internal buffer so that it can contain 1 second of audio samples
-        samples.resize(file.getSampleRate() * file.getChannelCount());
+        format = sampleFormat;
+        samples.assign(format, file.getSampleRate() * file.getChannelCount());
+
+        // Restart decoding ahead for the new file
+        if (decodeAhead != Time::Zero)
+            startDecoder();
+    }
+
+    [[nodiscard]] std::optional<std::uint64_t> loopTarget(std::uint64_t offset) const
+    {
+        // Either we're at the loop end, or we're at the EOF when it's
+        // equivalent to the loop end (loop end takes priority). Send us to loop begin
+        if ((loopSpan.length != 0) && (offset == loopSpan.offset + loopSpan.length))
+            return loopSpan.offset;
+
+        // If we're at the EOF, reset to 0
+        if (offset >= file.getSampleCount())
+            return 0;
+
+        return std::nullopt;
+    }
+
+    std::optional<std::uint64_t> loopFrom(std::uint64_t offset)
+    {
+        const auto target = loopTarget(offset);
+        if (!target)
+            return std::nullopt;
+
+        file.seek(*target);
+        return file.getSampleOffset();
     }
+
+    void startDecoder()
+    {
+        const auto frames = static_cast<std::size_t>(decodeAhead.asMicroseconds() * file.getSampleRate() / 1000000);
+
+        ring.assign(format, std::max<std::size_t>(frames, 1) * file.getChannelCount());
+        writePosition    = 0;
+        readPosition     = 0;
+        chunkEnd         = 0;
+        discardPosition  = 0;
+        boundaryPosition = noPosition;
+        passedBoundary   = noPosition;
+        pendingLoop.reset();
+        decoderStopped = false;
+        exitDecoder    = false;
+        decoder        = std::thread(&Impl::runDecoder, this);
+    }
+
+    void stopDecoder()
+    {
+        if (!decoder.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(mutex);
+            exitDecoder = true;
+        }
+
+        decoderCondition.notify_one();
+        decoder.join();
+        ring = {};
+    }
+
+    [[nodiscard]] std::unique_lock<std::recursive_mutex> lockDecoder()
+    {
+        // The decoder thread gives the mutex up between two blocks while a lock is requested here
+        lockRequests.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock lock(mutex);
+        lockRequests.fetch_sub(1, std::memory_order_relaxed);
+        return lock;
+    }
+
+    void discardDecoded()
+    {
+        // Must be called with the mutex locked, right after the file was seeked.
+        // Everything in the ring now belongs to the old position: the audio
+        // thread skips it, and the decoder resumes from the new position
+        discardPosition  = writePosition.load();
+        boundaryPosition = noPosition;
+        decoderStopped   = false;
+        decoderCondition.notify_one();
+
+        // Any seek left by the audio thread is outdated now; publishing
+        // this also publishes the discard position to the audio thread
+        deferredSeek.store(noPosition, std::memory_order_release);
+    }
+
+    void seekDeferred()
+    {
+        // Must be called with the mutex locked
+        const std::uint64_t offset = deferredSeek.load(std::memory_order_relaxed);
+        if (offset == noPosition)
+            return;
+
+        file.seek(offset);
+        discardDecoded();
+    }
+
+    void trySeek(std::uint64_t offset)
+    {
+        // Called on the audio thread, which must not wait for the decoder thread to finish a block:
+        // if the mutex is taken, the seek is left to the decoder thread, which does it after its
+        // current block, or to the next call of getDecodedData, whichever gets the mutex first
+        deferredSeek.store(offset, std::memory_order_relaxed);
+        [[maybe_unused]] const bool seeked = trySeekDeferred();
+    }
+
+    [[nodiscard]] bool trySeekDeferred()
+    {
+        const std::unique_lock lock(mutex, std::try_to_lock);
+        if (lock.owns_lock())
+            seekDeferred();
+
+        return lock.owns_lock();
+    }
+
+    void playSilence(SoundStream::Chunk& data)
+    {
+        // The decoder thread didn't keep up: play a short silence rather than waiting for it
+        const std::size_t silence = std::min<std::size_t>(std::max(file.getSampleRate() / 100, 1u) *
+                                                              file.getChannelCount(),
+                                                          samples.size());
+        samples.silence(silence);
+        underrunCount.fetch_add(1, std::memory_order_relaxed);
+
+        samples.lend(data, 0, silence);
+        data.persistent = true;
+    }
+
+    bool decodeNextBlock()
+    {
+        // Must be called with the mutex locked
+        if (decoderStopped)
+            return false;
+
+        const std::uint64_t write  = writePosition.load(std::memory_order_relaxed);
+        const std::uint64_t free   = ring.size() - (write - readPosition.load(std::memory_order_acquire));
+        const std::size_t   index  = static_cast<std::size_t>(write % ring.size());
+        auto                toFill = static_cast<std::size_t>(
+            std::min<std::uint64_t>({free, ring.size() - index, samples.size()}));
+
+        if (toFill == 0)
+            return false;
+
+        // Stop at the loop end, even when not looping: the audio thread
+        // decides what to do there from the looping state it sees
+        const std::uint64_t offset  = file.getSampleOffset();
+        const std::uint64_t loopEnd = loopSpan.offset + loopSpan.length;
+        const bool reachesLoopEnd   = (loopSpan.length != 0) && (offset < loopEnd) && (offset + toFill >= loopEnd);
+
+        if (reachesLoopEnd)
+            toFill = static_cast<std::size_t>(loopEnd - offset);
+
+        // Only one boundary can be pending at a time, wait for the audio thread to pass the previous one
+        const std::uint64_t boundary = boundaryPosition.load(std::memory_order_relaxed);
+        if ((boundary != noPosition) && (passedBoundary.load(std::memory_order_acquire) != boundary) &&
+            (reachesLoopEnd || (offset + toFill >= file.getSampleCount())))
+            return false;
+
+        const std::uint64_t count     = ring.read(file, index, toFill);
+        const std::uint64_t end       = offset + count;
+        const bool          endOfFile = (count == 0) || (end >= file.getSampleCount());
+
+        if ((reachesLoopEnd && (end == loopEnd)) || endOfFile)
+        {
+            // Decide now where the following samples come from, and record
+            // the decision so that the audio thread can check it when it gets there
+            std::optional<std::uint64_t> target;
+            if (looping.load(std::memory_order_relaxed))
+                target = loopFrom(end);
+
+            decoderStopped = !target && endOfFile;
+            boundaryOffset.store(end, std::memory_order_relaxed);
+            boundaryTarget.store(target.value_or(noPosition), std::memory_order_relaxed);
+            boundaryEnds.store(decoderStopped, std::memory_order_relaxed);
+            boundaryPosition.store(write + count, std::memory_order_relaxed);
+        }
+
+        // Publishing the write position also publishes the boundary
+        writePosition.store(write + count, std::memory_order_release);
+
+        return !decoderStopped;
+    }
+
+    void runDecoder()
+    {
+        std::unique_lock lock(mutex);
+
+        while (!exitDecoder)
+        {
+            // Carry out the seek the audio thread couldn't do without waiting for us
+            seekDeferred();
+
+            if (!decodeNextBlock())
+            {
+                // The audio thread never blocks to wake us up, so poll for free space in the ring
+                decoderCondition.wait_for(lock, std::chrono::milliseconds(10));
+            }
+            else if (lockRequests.load(std::memory_order_relaxed) > 0)
+            {
+                // Let a seek or a loop change through now, rather than once the ring is full
+                lock.unlock();
+                while (lockRequests.load(std::memory_order_relaxed) > 0)
+                    std::this_thread::yield();
+                lock.lock();
+            }
+        }
+    }
+
+    struct PendingLoop
+    {
+        std::uint64_t offset{}; //!< File offset of the boundary
+        std::uint64_t target{}; //!< File offset the decoder continued from, or `noPosition`
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    InputSoundFile              file;                         //!< The streamed music file
+    SampleFormat                format{SampleFormat::Int16};  //!< Format of the streamed samples
+    SampleBuffer                samples;                      //!< Temporary buffer of samples
+    std::recursive_mutex        mutex;                        //!< Mutex protecting the data
+    Span<std::uint64_t>         loopSpan;                     //!< Loop Range Specifier
+    Time                        decodeAhead;                  //!< Duration of audio to decode ahead, zero if disabled
+    SampleBuffer                ring;                         //!< Decode-ahead ring, empty when not decoding ahead
+    std::atomic<std::uint64_t>  writePosition{};              //!< Number of samples written to the ring
+    std::atomic<std::uint64_t>  readPosition{};               //!< Number of samples read from the ring
+    std::atomic<std::uint64_t>  discardPosition{};            //!< Samples before this position predate the last seek
+    std::atomic<std::uint64_t>  boundaryPosition{noPosition}; //!< Ring position of the pending loop end or end of file
+    std::atomic<std::uint64_t>  boundaryOffset{};             //!< File offset at the pending boundary
+    std::atomic<std::uint64_t>  boundaryTarget{noPosition};   //!< File offset the decoder looped to, or `noPosition`
+    std::atomic<bool>           boundaryEnds{};               //!< Whether the decoder stopped at the pending boundary
+    std::atomic<std::uint64_t>  passedBoundary{noPosition};   //!< Last boundary handled by the audio thread
+    std::atomic<std::uint64_t>  deferredSeek{noPosition};     //!< File offset the audio thread couldn't seek to yet, or `noPosition`
+    std::uint64_t               chunkEnd{};                   //!< End of the chunk lent to the stream
+    std::atomic<std::uint64_t>  underrunCount{};              //!< Number of times the ring ran dry
+    std::atomic<bool>           looping{};                    //!< Looping state last seen by the audio thread
+    std::atomic<unsigned int>   lockRequests{};               //!< Number of threads waiting in `lockDecoder()`
+    std::optional<PendingLoop>  pendingLoop;                  //!< Boundary the audio thread stopped at
+    bool                        decoderStopped{};             //!< Whether the decoder reached an end it can't go past
+    bool                        exitDecoder{};                //!< Request for the decoder thread to exit
+    std::condition_variable_any decoderCondition;             //!< Wakes the decoder thread up
+    std::thread                 decoder;                      //!< Decoder thread
 };
 
 
@@ -66,25 +374,25 @@ Music::Music() : m_impl(std::make_unique<Impl>())
 
 
 ////////////////////////////////////////////////////////////
-Music::Music(const std::filesystem::path& filename) : Music()
+Music::Music(const std::filesystem::path& filename, SampleFormat format) : Music()
 {
-    if (!openFromFile(filename))
+    if (!openFromFile(filename, format))
         throw sf::Exception("Failed to open music from file");
 }
 
 
 ////////////////////////////////////////////////////////////
-Music::Music(const void* data, std::size_t sizeInBytes) : Music()
+Music::Music(const void* data, std::size_t sizeInBytes, SampleFormat format) : Music()
 {
-    if (!openFromMemory(data, sizeInBytes))
+    if (!openFromMemory(data, sizeInBytes, format))
         throw sf::Exception("Failed to open music from memory");
 }
 
 
 ////////////////////////////////////////////////////////////
-Music::Music(InputStream& stream) : Music()
+Music::Music(InputStream& stream, SampleFormat format) : Music()
 {
-    if (!openFromStream(stream))
+    if (!openFromStream(stream, format))
         throw sf::Exception("Failed to open music from stream");
 }
 
@@ -109,10 +417,11 @@ Music& Music::operator=(Music&&) noexcept = default;
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromFile(const std::filesystem::path& filename)
+bool Music::openFromFile(const std::filesystem::path& filename, SampleFormat format)
 {
     // First stop the music if it was already running
     stop();
+    m_impl->stopDecoder();
 
     // Open the underlying sound file
     if (!m_impl->file.openFromFile(filename))
@@ -122,20 +431,24 @@ bool Music::openFromFile(const std::filesystem::path& filename)
     }
 
     // Perform common initializations
-    m_impl->initialize();
+    m_impl->initialize(format);
 
     // Initialize the stream
-    SoundStream::initialize(m_impl->file.getChannelCount(), m_impl->file.getSampleRate(), m_impl->file.getChannelMap());
+    SoundStream::initialize(m_impl->file.getChannelCount(),
+                            m_impl->file.getSampleRate(),
+                            m_impl->file.getChannelMap(),
+                            format);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
+bool Music::openFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat format)
 {
     // First stop the music if it was already running
     stop();
+    m_impl->stopDecoder();
 
     // Open the underlying sound file
     if (!m_impl->file.openFromMemory(data, sizeInBytes))
@@ -145,20 +458,24 @@ bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
     }
 
     // Perform common initializations
-    m_impl->initialize();
+    m_impl->initialize(format);
 
     // Initialize the stream
-    SoundStream::initialize(m_impl->file.getChannelCount(), m_impl->file.getSampleRate(), m_impl->file.getChannelMap());
+    SoundStream::initialize(m_impl->file.getChannelCount(),
+                            m_impl->file.getSampleRate(),
+                            m_impl->file.getChannelMap(),
+                            format);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromStream(InputStream& stream)
+bool Music::openFromStream(InputStream& stream, SampleFormat format)
 {
     // First stop the music if it was already running
     stop();
+    m_impl->stopDecoder();
 
     // Open the underlying sound file
     if (!m_impl->file.openFromStream(stream))
@@ -168,10 +485,13 @@ bool Music::openFromStream(InputStream& stream)
     }
 
     // Perform common initializations
-    m_impl->initialize();
+    m_impl->initialize(format);
 
     // Initialize the stream
-    SoundStream::initialize(m_impl->file.getChannelCount(), m_impl->file.getSampleRate(), m_impl->file.getChannelMap());
+    SoundStream::initialize(m_impl->file.getChannelCount(),
+                            m_impl->file.getSampleRate(),
+                            m_impl->file.getChannelMap(),
+                            format);
 
     return true;
 }
@@ -239,7 +559,17 @@ void Music::setLoopPoints(TimeSpan timePoints)
     stop();
 
     // Set
-    m_impl->loopSpan = samplePoints;
+    {
+        const auto lock  = m_impl->lockDecoder();
+        m_impl->loopSpan = samplePoints;
+
+        // What was decoded ahead stopped at the old loop end, start over from the beginning
+        if (!m_impl->ring.empty())
+        {
+            m_impl->file.seek(0);
+            m_impl->discardDecoded();
+        }
+    }
 
     // Restore
     if (oldPos != Time::Zero)
@@ -251,9 +581,63 @@ void Music::setLoopPoints(TimeSpan timePoints)
 }
 
 
+////////////////////////////////////////////////////////////
+void Music::setDecodeAhead(Time duration)
+{
+    duration = std::max(duration, Time::Zero);
+
+    if (duration == m_impl->decodeAhead)
+        return;
+
+    // When we apply this change, we need to "reset" this instance and its buffer
+
+    // Get old playing status and position
+    const Status oldStatus = getStatus();
+    const Time   oldPos    = getPlayingOffset();
+
+    // Unload
+    stop();
+    m_impl->stopDecoder();
+
+    // Set
+    m_impl->decodeAhead = duration;
+    if ((duration != Time::Zero) && (getChannelCount() != 0))
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->file.seek(0);
+        m_impl->startDecoder();
+    }
+
+    // Restore
+    if (oldPos != Time::Zero)
+        setPlayingOffset(oldPos);
+
+    // Resume
+    if (oldStatus == Status::Playing)
+        play();
+}
+
+
+////////////////////////////////////////////////////////////
+Time Music::getDecodeAhead() const
+{
+    return m_impl->decodeAhead;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t Music::getUnderrunCount() const
+{
+    return m_impl->underrunCount.load(std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Music::onGetData(SoundStream::Chunk& data)
 {
+    if (!m_impl->ring.empty())
+        return getDecodedData(data);
+
     const std::lock_guard lock(m_impl->mutex);
 
     std::size_t         toFill        = m_impl->samples.size();
@@ -267,8 +651,8 @@ bool Music::onGetData(SoundStream::Chunk& data)
         toFill = static_cast<std::size_t>(loopEnd - currentOffset);
 
     // Fill the chunk parameters
-    data.samples     = m_impl->samples.data();
-    data.sampleCount = static_cast<std::size_t>(m_impl->file.read(m_impl->samples.data(), toFill));
+    m_impl->samples.lend(data, 0, static_cast<std::size_t>(m_impl->samples.read(m_impl->file, 0, toFill)));
+    data.persistent = true;
     currentOffset += data.sampleCount;
 
     // Check if we have stopped obtaining samples or reached either the EOF or the loop end point
@@ -280,8 +664,16 @@ bool Music::onGetData(SoundStream::Chunk& data)
 ////////////////////////////////////////////////////////////
 void Music::onSeek(Time timeOffset)
 {
-    const std::lock_guard lock(m_impl->mutex);
+    const auto lock = m_impl->lockDecoder();
     m_impl->file.seek(timeOffset);
+
+    if (!m_impl->ring.empty())
+    {
+        // Start over from the new position, and have the first block ready for the audio thread
+        m_impl->looping = isLooping();
+        m_impl->discardDecoded();
+        [[maybe_unused]] const bool decoded = m_impl->decodeNextBlock();
+    }
 }
 
 
@@ -289,26 +681,121 @@ void Music::onSeek(Time timeOffset)
 std::optional<std::uint64_t> Music::onLoop()
 {
     // Called by underlying SoundStream so we can determine where to loop.
+    if (!m_impl->ring.empty())
+    {
+        const auto pendingLoop = std::exchange(m_impl->pendingLoop, std::nullopt);
+        if (!pendingLoop)
+            return std::nullopt;
+
+        // The decoder already looped for us
+        if (pendingLoop->target != Impl::noPosition)
+            return pendingLoop->target;
+
+        // Looping was enabled after the decoder went past this point: seek now if the mutex is
+        // free, otherwise getDecodedData plays silence until the seek is done
+        const auto seekPositionAfterLoop = m_impl->loopTarget(pendingLoop->offset);
+        if (seekPositionAfterLoop)
+            m_impl->trySeek(*seekPositionAfterLoop);
+
+        return seekPositionAfterLoop;
+    }
+
     const std::lock_guard lock(m_impl->mutex);
-    const std::uint64_t   currentOffset = m_impl->file.getSampleOffset();
 
-    if (isLooping() && (m_impl->loopSpan.length != 0) &&
-        (currentOffset == m_impl->loopSpan.offset + m_impl->loopSpan.length))
+    if (isLooping())
+        return m_impl->loopFrom(m_impl->file.getSampleOffset());
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Music::getDecodedData(SoundStream::Chunk& data)
+{
+    // Called on the audio thread: only read samples from the ring, and leave the decoding to the decoder thread
+    auto&      impl    = *m_impl;
+    const bool looping = isLooping();
+    impl.looping.store(looping, std::memory_order_relaxed);
+
+    // The stream is done with the chunk we lent it last time, give its space back to the decoder
+    impl.readPosition.store(impl.chunkEnd, std::memory_order_release);
+
+    // What follows in the ring is stale until a deferred seek is done, retry it
+    if ((impl.deferredSeek.load(std::memory_order_acquire) != Impl::noPosition) && !impl.trySeekDeferred())
     {
-        // Looping is enabled, and either we're at the loop end, or we're at the EOF
-        // when it's equivalent to the loop end (loop end takes priority). Send us to loop begin
-        m_impl->file.seek(m_impl->loopSpan.offset);
-        return m_impl->file.getSampleOffset();
+        impl.playSilence(data);
+        return true;
     }
 
-    if (isLooping() && (currentOffset >= m_impl->file.getSampleCount()))
+    std::uint64_t start = std::max(impl.chunkEnd, impl.discardPosition.load(std::memory_order_acquire));
+    std::uint64_t end   = impl.writePosition.load(std::memory_order_acquire);
+
+    // The ring is dry, which usually happens right after a seek: if the
+    // decoder thread is idle we can decode the next block ourselves
+    if (start == end)
     {
-        // If we're at the EOF, reset to 0
-        m_impl->file.seek(0);
-        return 0;
+        if (const std::unique_lock lock(impl.mutex, std::try_to_lock); lock.owns_lock())
+        {
+            impl.readPosition.store(start, std::memory_order_release);
+            [[maybe_unused]] const bool decoded = impl.decodeNextBlock();
+
+            start = std::max(start, impl.discardPosition.load(std::memory_order_acquire));
+            end   = impl.writePosition.load(std::memory_order_acquire);
+        }
     }
 
-    return std::nullopt;
+    // Don't read past the pending boundary (loop end or end of file) before deciding what comes after it
+    const std::uint64_t boundary      = impl.boundaryPosition.load(std::memory_order_relaxed);
+    const bool          boundaryAhead = (boundary != Impl::noPosition) && (boundary >= start) &&
+                               (impl.passedBoundary.load(std::memory_order_relaxed) != boundary);
+    const std::uint64_t limit         = boundaryAhead ? std::min(boundary, end) : end;
+
+    // Lend at most half of the ring, so that the decoder can keep working while the chunk is played
+    const auto index    = static_cast<std::size_t>(start % impl.ring.size());
+    const auto maxCount = std::max<std::size_t>(impl.ring.size() / 2 / getChannelCount(), 1) * getChannelCount();
+    const auto count    = static_cast<std::size_t>(
+        std::min<std::uint64_t>({limit - start, impl.ring.size() - index, maxCount, impl.samples.size()}));
+
+    impl.chunkEnd   = start + count;
+    data.persistent = true;
+
+    if ((count == 0) && !(boundaryAhead && (start == boundary)))
+    {
+        impl.playSilence(data);
+        return true;
+    }
+
+    // Let the stream play the samples in place, they stay in the ring until the next call
+    impl.ring.lend(data, index, count);
+
+    if (!boundaryAhead || (start + count != boundary))
+        return true;
+
+    // We reached the boundary: let the decoder go past it, and check
+    // that what it decoded after it matches the current looping state
+    const std::uint64_t offset = impl.boundaryOffset.load(std::memory_order_relaxed);
+    const std::uint64_t target = impl.boundaryTarget.load(std::memory_order_relaxed);
+    const bool          ends   = impl.boundaryEnds.load(std::memory_order_relaxed);
+    impl.passedBoundary.store(boundary, std::memory_order_release);
+
+    if (looping)
+    {
+        // Stop the chunk here, this will trip an "onLoop()" call from the underlying SoundStream
+        impl.pendingLoop = Impl::PendingLoop{offset, target};
+        return false;
+    }
+
+    if (ends || (offset >= impl.file.getSampleCount()))
+        return false;
+
+    if (target != Impl::noPosition)
+    {
+        // Looping was disabled after the decoder jumped back to the loop begin, seek
+        // to continue after the loop end (the next calls play silence until it is done)
+        impl.trySeek(offset);
+    }
+
+    return true;
 }
 
 
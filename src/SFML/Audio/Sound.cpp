@@ -97,9 +97,18 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
         // Copy the samples to the output
         const auto sampleCount = *framesRead * buffer->getChannelCount();
 
-        std::memcpy(framesOut,
-                    buffer->getSamples() + impl.cursor,
-                    static_cast<std::size_t>(sampleCount) * sizeof(buffer->getSamples()[0]));
+        if (buffer->getSampleFormat() == SampleFormat::Float32)
+        {
+            std::memcpy(framesOut,
+                        buffer->getFloatSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(float));
+        }
+        else
+        {
+            std::memcpy(framesOut,
+                        buffer->getSamples() + impl.cursor,
+                        static_cast<std::size_t>(sampleCount) * sizeof(std::int16_t));
+        }
 
         impl.cursor += static_cast<std::size_t>(sampleCount);
 
@@ -134,7 +143,8 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
         const auto* buffer = impl.buffer;
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
+        *format     = priv::MiniaudioUtils::sampleFormatToMiniaudioFormat(
+            buffer ? buffer->getSampleFormat() : SampleFormat::Int16);
         *channels   = buffer && buffer->getChannelCount() ? buffer->getChannelCount() : 1;
         *sampleRate = buffer && buffer->getSampleRate() ? buffer->getSampleRate() : 44100;
 
@@ -29,37 +29,74 @@
 #include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundFileFactory.hpp>
+#include <SFML/Audio/SoundFileReader.hpp>
+#include <SFML/Audio/SoundFileReaderWav.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/ThreadPool.hpp>
+#include <SFML/System/Utils.hpp>
 
-#include <exception>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <utility>
 
 
+namespace
+{
+// Files with fewer samples than this are never split into ranges (about 12 s of 44.1 kHz stereo)
+constexpr std::uint64_t minRangeSampleCount = 1 << 20;
+
+////////////////////////////////////////////////////////////
+std::int16_t toInt16(float sample)
+{
+    return static_cast<std::int16_t>(std::clamp(sample, -1.f, 1.f) * 32767.f);
+}
+
+
+////////////////////////////////////////////////////////////
+// Pool of threads decoding the files given to loadManyAsync; it is shared by all the calls,
+// started on first use, and abandons the files that didn't start decoding when the program exits
+sf::priv::ThreadPool& getDecoderPool()
+{
+    // The threads may still be decoding when the pool is destroyed at exit, so make sure
+    // that the registered readers are created before the pool and thus destroyed after it
+    // (which is why the pool shared by the whole program is not used)
+    [[maybe_unused]] static const bool readersCreated =
+        sf::SoundFileFactory::isReaderRegistered<sf::priv::SoundFileReaderWav>();
+
+    static sf::priv::ThreadPool pool(0, sf::priv::ThreadPool::Shutdown::AbandonPendingTasks);
+    return pool;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer(const std::filesystem::path& filename)
+SoundBuffer::SoundBuffer(const std::filesystem::path& filename, SampleFormat format)
 {
-    if (!loadFromFile(filename))
+    if (!loadFromFile(filename, format))
         throw sf::Exception("Failed to open sound buffer from file");
 }
 
 
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer(const void* data, std::size_t sizeInBytes)
+SoundBuffer::SoundBuffer(const void* data, std::size_t sizeInBytes, SampleFormat format)
 {
-    if (!loadFromMemory(data, sizeInBytes))
+    if (!loadFromMemory(data, sizeInBytes, format))
         throw sf::Exception("Failed to open sound buffer from memory");
 }
 
 
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer(InputStream& stream)
+SoundBuffer::SoundBuffer(InputStream& stream, SampleFormat format)
 {
-    if (!loadFromStream(stream))
+    if (!loadFromStream(stream, format))
         throw sf::Exception("Failed to open sound buffer from stream");
 }
 
@@ -76,12 +113,26 @@ SoundBuffer::SoundBuffer(const std::int16_t*              samples,
 }
 
 
+////////////////////////////////////////////////////////////
+SoundBuffer::SoundBuffer(const float*                     samples,
+                         std::uint64_t                    sampleCount,
+                         unsigned int                     channelCount,
+                         unsigned int                     sampleRate,
+                         const std::vector<SoundChannel>& channelMap)
+{
+    if (!loadFromSamples(samples, sampleCount, channelCount, sampleRate, channelMap))
+        throw sf::Exception("Failed to open sound buffer from samples");
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer(const SoundBuffer& copy)
 {
     // don't copy the attached sounds
-    m_samples  = copy.m_samples;
-    m_duration = copy.m_duration;
+    m_samples      = copy.m_samples;
+    m_floatSamples = copy.m_floatSamples;
+    m_sampleFormat = copy.m_sampleFormat;
+    m_duration     = copy.m_duration;
 
     // Update the internal buffer with the new samples
     if (!update(copy.getChannelCount(), copy.getSampleRate(), copy.getChannelMap()))
@@ -89,6 +140,32 @@ SoundBuffer::SoundBuffer(const SoundBuffer& copy)
 }
 
 
+////////////////////////////////////////////////////////////
+SoundBuffer::SoundBuffer(SoundBuffer&& other) noexcept :
+m_samples(std::move(other.m_samples)),
+m_floatSamples(std::move(other.m_floatSamples)),
+m_sampleFormat(other.m_sampleFormat),
+m_sampleRate(other.m_sampleRate),
+m_channelMap(std::move(other.m_channelMap)),
+m_duration(other.m_duration)
+{
+    // The sounds using the moved-from buffer can't play samples that are gone, so detach them
+    SoundList sounds;
+    sounds.swap(other.m_sounds);
+
+    for (Sound* soundPtr : sounds)
+        soundPtr->detachBuffer();
+
+    // Leave the moved-from buffer empty, as if it was default-constructed
+    other.m_samples.clear();
+    other.m_floatSamples.clear();
+    other.m_sampleFormat = SampleFormat::Int16;
+    other.m_sampleRate   = 44100;
+    other.m_channelMap   = {SoundChannel::Mono};
+    other.m_duration     = Time::Zero;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundBuffer::~SoundBuffer()
 {
@@ -105,11 +182,11 @@ SoundBuffer::~SoundBuffer()
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromFile(const std::filesystem::path& filename)
+bool SoundBuffer::loadFromFile(const std::filesystem::path& filename, SampleFormat format)
 {
     InputSoundFile file;
     if (file.openFromFile(filename))
-        return initialize(file);
+        return initialize(file, format);
 
     err() << "Failed to open sound buffer from file" << std::endl;
     return false;
@@ -117,11 +194,11 @@ bool SoundBuffer::loadFromFile(const std::filesystem::path& filename)
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
+bool SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat format)
 {
     InputSoundFile file;
     if (file.openFromMemory(data, sizeInBytes))
-        return initialize(file);
+        return initialize(file, format);
 
     err() << "Failed to open sound buffer from memory" << std::endl;
     return false;
@@ -129,17 +206,51 @@ bool SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromStream(InputStream& stream)
+bool SoundBuffer::loadFromStream(InputStream& stream, SampleFormat format)
 {
     InputSoundFile file;
     if (file.openFromStream(stream))
-        return initialize(file);
+        return initialize(file, format);
 
     err() << "Failed to open sound buffer from stream" << std::endl;
     return false;
 }
 
 
+////////////////////////////////////////////////////////////
+std::vector<std::future<SoundBuffer>> SoundBuffer::loadManyAsync(const std::vector<std::filesystem::path>& filenames,
+                                                                 SampleFormat                              format)
+{
+    std::vector<std::future<SoundBuffer>> futures;
+    futures.reserve(filenames.size());
+
+    if (filenames.empty())
+        return futures;
+
+    // The threads left over when there are fewer files than threads in the pool go to splitting large files
+    priv::ThreadPool& pool       = getDecoderPool();
+    const std::size_t rangeCount = std::max(pool.getThreadCount() / filenames.size(), std::size_t{1});
+
+    for (const std::filesystem::path& filename : filenames)
+    {
+        std::packaged_task<SoundBuffer()> task(
+            [filename, format, rangeCount]
+            {
+                SoundBuffer buffer;
+                if (!buffer.initialize(filename, format, rangeCount))
+                    throw Exception("Failed to open sound buffer from file");
+
+                return buffer;
+            });
+
+        futures.push_back(task.get_future());
+        pool.enqueue(std::packaged_task<void()>(std::move(task)));
+    }
+
+    return futures;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::loadFromSamples(const std::int16_t*              samples,
                                   std::uint64_t                    sampleCount,
@@ -151,6 +262,37 @@ bool SoundBuffer::loadFromSamples(const std::int16_t*              samples,
     {
         // Copy the new audio samples
         m_samples.assign(samples, samples + sampleCount);
+        m_floatSamples.clear();
+        m_sampleFormat = SampleFormat::Int16;
+
+        // Update the internal buffer with the new samples
+        return update(channelCount, sampleRate, channelMap);
+    }
+
+    // Error...
+    err() << "Failed to load sound buffer from samples ("
+          << "array: " << samples << ", "
+          << "count: " << sampleCount << ", "
+          << "channels: " << channelCount << ", "
+          << "samplerate: " << sampleRate << ")" << std::endl;
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::loadFromSamples(const float*                     samples,
+                                  std::uint64_t                    sampleCount,
+                                  unsigned int                     channelCount,
+                                  unsigned int                     sampleRate,
+                                  const std::vector<SoundChannel>& channelMap)
+{
+    if (samples && sampleCount && channelCount && sampleRate && !channelMap.empty())
+    {
+        // Copy the new audio samples
+        m_floatSamples.assign(samples, samples + sampleCount);
+        m_samples.clear();
+        m_sampleFormat = SampleFormat::Float32;
 
         // Update the internal buffer with the new samples
         return update(channelCount, sampleRate, channelMap);
@@ -174,8 +316,28 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
     OutputSoundFile file;
     if (file.openFromFile(filename, getSampleRate(), getChannelCount(), getChannelMap()))
     {
-        // Write the samples to the opened file
-        file.write(m_samples.data(), m_samples.size());
+        if (m_sampleFormat == SampleFormat::Int16)
+        {
+            // Write the samples to the opened file
+            file.write(m_samples.data(), m_samples.size());
+        }
+        else
+        {
+            // Writers only accept 16 bit samples, convert the float samples block by block
+            std::array<std::int16_t, 4096> block{};
+
+            for (std::size_t offset = 0; offset < m_floatSamples.size(); offset += block.size())
+            {
+                const std::size_t count = std::min(block.size(), m_floatSamples.size() - offset);
+
+                std::transform(m_floatSamples.begin() + static_cast<std::ptrdiff_t>(offset),
+                               m_floatSamples.begin() + static_cast<std::ptrdiff_t>(offset + count),
+                               block.begin(),
+                               toInt16);
+
+                file.write(block.data(), count);
+            }
+        }
 
         return true;
     }
@@ -187,14 +349,42 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 ////////////////////////////////////////////////////////////
 const std::int16_t* SoundBuffer::getSamples() const
 {
+    if (m_sampleFormat == SampleFormat::Float32)
+    {
+        // Conversions are rare, a single mutex shared by all buffers is enough to make them thread-safe
+        static std::mutex     conversionMutex;
+        const std::lock_guard lock(conversionMutex);
+
+        // Every function that changes the float samples clears their 16 bit copy
+        if (m_samples.size() != m_floatSamples.size())
+        {
+            m_samples.resize(m_floatSamples.size());
+            std::transform(m_floatSamples.begin(), m_floatSamples.end(), m_samples.begin(), toInt16);
+        }
+    }
+
     return m_samples.empty() ? nullptr : m_samples.data();
 }
 
 
+////////////////////////////////////////////////////////////
+const float* SoundBuffer::getFloatSamples() const
+{
+    return m_floatSamples.empty() ? nullptr : m_floatSamples.data();
+}
+
+
+////////////////////////////////////////////////////////////
+SampleFormat SoundBuffer::getSampleFormat() const
+{
+    return m_sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    return m_sampleFormat == SampleFormat::Float32 ? m_floatSamples.size() : m_samples.size();
 }
 
 
@@ -232,6 +422,25 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
     SoundBuffer temp(right);
 
     std::swap(m_samples, temp.m_samples);
+    std::swap(m_floatSamples, temp.m_floatSamples);
+    std::swap(m_sampleFormat, temp.m_sampleFormat);
+    std::swap(m_sampleRate, temp.m_sampleRate);
+    std::swap(m_channelMap, temp.m_channelMap);
+    std::swap(m_duration, temp.m_duration);
+    std::swap(m_sounds, temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer& SoundBuffer::operator=(SoundBuffer&& right) noexcept
+{
+    SoundBuffer temp(std::move(right));
+
+    std::swap(m_samples, temp.m_samples);
+    std::swap(m_floatSamples, temp.m_floatSamples);
+    std::swap(m_sampleFormat, temp.m_sampleFormat);
     std::swap(m_sampleRate, temp.m_sampleRate);
     std::swap(m_channelMap, temp.m_channelMap);
     std::swap(m_duration, temp.m_duration);
@@ -242,14 +451,29 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::initialize(InputSoundFile& file)
+bool SoundBuffer::initialize(InputSoundFile& file, SampleFormat format)
 {
     // Retrieve the sound parameters
     const std::uint64_t sampleCount = file.getSampleCount();
 
-    // Read the samples from the provided file
-    m_samples.resize(static_cast<std::size_t>(sampleCount));
-    if (file.read(m_samples.data(), sampleCount) == sampleCount)
+    // Read the samples from the provided file, in the requested format
+    std::uint64_t readCount = 0;
+    m_sampleFormat          = format;
+
+    if (format == SampleFormat::Float32)
+    {
+        m_samples.clear();
+        m_floatSamples.resize(static_cast<std::size_t>(sampleCount));
+        readCount = file.readFloat(m_floatSamples.data(), sampleCount);
+    }
+    else
+    {
+        m_floatSamples.clear();
+        m_samples.resize(static_cast<std::size_t>(sampleCount));
+        readCount = file.read(m_samples.data(), sampleCount);
+    }
+
+    if (readCount == sampleCount)
     {
         // Update the internal buffer with the new samples
         if (!update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
@@ -265,6 +489,83 @@ bool SoundBuffer::initialize(InputSoundFile& file)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::initialize(const std::filesystem::path& filename, SampleFormat format, std::size_t rangeCount)
+{
+    InputSoundFile file;
+    if (!file.openFromFile(filename))
+        return false;
+
+    const std::uint64_t sampleCount  = file.getSampleCount();
+    const std::uint64_t channelCount = file.getChannelCount();
+    rangeCount = static_cast<std::size_t>(std::min<std::uint64_t>(rangeCount, sampleCount / minRangeSampleCount));
+
+    // Only readers that land on the exact sample they are asked for can decode separate ranges
+    if (rangeCount <= 1 || !file.m_reader->isSeekExact())
+        return initialize(file, format);
+
+    // Every range reads into its own slice of the final storage
+    m_sampleFormat = format;
+    if (format == SampleFormat::Float32)
+    {
+        m_samples.clear();
+        m_floatSamples.resize(static_cast<std::size_t>(sampleCount));
+    }
+    else
+    {
+        m_floatSamples.clear();
+        m_samples.resize(static_cast<std::size_t>(sampleCount));
+    }
+
+    const auto readRange = [this, format](InputSoundFile& rangeFile, std::uint64_t first, std::uint64_t count)
+    {
+        rangeFile.seek(first);
+        if (format == SampleFormat::Float32)
+            return rangeFile.readFloat(m_floatSamples.data() + first, count) == count;
+
+        return rangeFile.read(m_samples.data() + first, count) == count;
+    };
+
+    // Ranges are cut on frame boundaries; the first one is decoded on this thread
+    const std::uint64_t frameCount     = sampleCount / channelCount;
+    const std::uint64_t framesPerRange = (frameCount + rangeCount - 1) / rangeCount;
+    const auto          rangeStart     = [&](std::uint64_t range)
+    { return std::min(range * framesPerRange, frameCount) * channelCount; };
+
+    std::vector<std::future<bool>> ranges;
+    for (std::uint64_t range = 1; range < rangeCount; ++range)
+    {
+        const std::uint64_t first = rangeStart(range);
+        const std::uint64_t count = rangeStart(range + 1) - first;
+        ranges.push_back(std::async(std::launch::async,
+                                    [&filename, &readRange, first, count]
+                                    {
+                                        InputSoundFile rangeFile;
+                                        return rangeFile.openFromFile(filename) && readRange(rangeFile, first, count);
+                                    }));
+    }
+
+    bool success = readRange(file, 0, rangeStart(1));
+    for (auto& range : ranges)
+        success = range.get() && success;
+
+    if (!success)
+    {
+        err() << "Failed to decode sound file in parallel ranges\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Update the internal buffer with the new samples
+    if (!update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
+    {
+        err() << "Failed to initialize sound buffer (internal update failure)" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap)
 {
@@ -284,7 +585,7 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
 
     // Compute the duration
     m_duration = seconds(
-        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+        static_cast<float>(getSampleCount()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
 
     // Now reattach the buffer to the sounds that use it
     for (Sound* soundPtr : sounds)
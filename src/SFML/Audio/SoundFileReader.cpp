@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundFileReader.hpp>
+
+#include <algorithm>
+#include <array>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReader::readFloat(float* samples, std::uint64_t maxCount)
+{
+    // Decode in blocks of 16 bit samples and convert them as we go
+    std::array<std::int16_t, 4096> block{};
+
+    std::uint64_t count = 0;
+    while (count < maxCount)
+    {
+        const auto blockCount = read(block.data(), std::min<std::uint64_t>(block.size(), maxCount - count));
+
+        // Stop on error or end of file
+        if (blockCount == 0)
+            break;
+
+        for (std::uint64_t i = 0; i < blockCount; ++i)
+            samples[count + i] = static_cast<float>(block[static_cast<std::size_t>(i)]) / 32768.f;
+
+        count += blockCount;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReader::isSeekExact() const
+{
+    return false;
+}
+
+} // namespace sf
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
@@ -101,6 +102,65 @@ FLAC__bool streamEof(const FLAC__StreamDecoder*, void* clientData)
     return data->stream->tell() == data->stream->getSize();
 }
 
+auto int16Converter(unsigned int bitsPerSample)
+{
+    assert((bitsPerSample == 8 || bitsPerSample == 16 || bitsPerSample == 24 || bitsPerSample == 32) &&
+           "Invalid bits per sample. Must be 8, 16, 24, or 32.");
+
+    // Keep the 16 most significant bits of the sample
+    const int shift = static_cast<int>(bitsPerSample) - 16;
+    return [shift](FLAC__int32 sample)
+    {
+        return shift >= 0 ? static_cast<std::int16_t>(sample >> shift) : static_cast<std::int16_t>(sample << -shift);
+    };
+}
+
+auto floatConverter(unsigned int bitsPerSample)
+{
+    const float scale = 1.f / static_cast<float>(std::uint64_t{1} << (bitsPerSample - 1));
+    return [scale](FLAC__int32 sample) { return static_cast<float>(sample) * scale; };
+}
+
+template <typename T, typename Converter>
+void interleave(const FLAC__int32* const buffer[],
+                unsigned int             channelCount,
+                std::size_t              first,
+                std::size_t              count,
+                T*                       output,
+                Converter                convert)
+{
+    // Walk the channels of each frame in turn, starting in the middle of a frame if needed
+    std::size_t  frame   = first / channelCount;
+    unsigned int channel = static_cast<unsigned int>(first % channelCount);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        output[i] = convert(buffer[channel][frame]);
+
+        if (++channel == channelCount)
+        {
+            channel = 0;
+            ++frame;
+        }
+    }
+}
+
+template <typename T>
+void interleave(const FLAC__int32* const buffer[],
+                unsigned int             channelCount,
+                unsigned int             bitsPerSample,
+                std::size_t              first,
+                std::size_t              count,
+                T*                       output)
+{
+    if constexpr (std::is_same_v<T, float>)
+        interleave(buffer, channelCount, first, count, output, floatConverter(bitsPerSample));
+    else if constexpr (std::is_same_v<T, std::int16_t>)
+        interleave(buffer, channelCount, first, count, output, int16Converter(bitsPerSample));
+    else
+        interleave(buffer, channelCount, first, count, output, [](FLAC__int32 sample) { return sample; });
+}
+
 FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
                                            const FLAC__Frame*       frame,
                                            const FLAC__int32* const buffer[],
@@ -108,50 +168,42 @@ FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
 {
     auto* data = static_cast<sf::priv::SoundFileReaderFlac::ClientData*>(clientData);
 
-    // Reserve memory if we're going to use the leftovers buffer
-    const unsigned int frameSamples = frame->header.blocksize * frame->header.channels;
-    if (data->remaining < frameSamples)
-        data->leftovers.reserve(static_cast<std::size_t>(frameSamples - data->remaining));
+    const unsigned int channelCount  = frame->header.channels;
+    const unsigned int bitsPerSample = frame->header.bits_per_sample;
+    const std::size_t  frameSamples  = std::size_t{frame->header.blocksize} * channelCount;
 
-    // Decode the samples
-    for (unsigned i = 0; i < frame->header.blocksize; ++i)
+    // Interleave as many samples as the caller asked for straight into its buffer
+    std::size_t direct = 0;
+    if (data->buffer || data->floatBuffer)
     {
-        for (unsigned int j = 0; j < frame->header.channels; ++j)
+        direct = static_cast<std::size_t>(std::min<std::uint64_t>(data->remaining, frameSamples));
+
+        if (data->floatBuffer)
+        {
+            interleave(buffer, channelCount, bitsPerSample, 0, direct, data->floatBuffer);
+            data->floatBuffer += direct;
+        }
+        else
         {
-            // Decode the current sample
-            std::int16_t sample = 0;
-            switch (frame->header.bits_per_sample)
-            {
-                case 8:
-                    sample = static_cast<std::int16_t>(buffer[j][i] << 8);
-                    break;
-                case 16:
-                    sample = static_cast<std::int16_t>(buffer[j][i]);
-                    break;
-                case 24:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 8);
-                    break;
-                case 32:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 16);
-                    break;
-                default:
-                    assert(false && "Invalid bits per sample. Must be 8, 16, 24, or 32.");
-                    break;
-            }
-
-            if (data->buffer && data->remaining > 0)
-            {
-                // If there's room in the output buffer, copy the sample there
-                *data->buffer++ = sample;
-                --data->remaining;
-            }
-            else
-            {
-                // We are either seeking (null buffer) or have decoded all the requested samples during a
-                // normal read (0 remaining), so we put the sample in a temporary buffer until next call
-                data->leftovers.push_back(sample);
-            }
+            interleave(buffer, channelCount, bitsPerSample, 0, direct, data->buffer);
+            data->buffer += direct;
         }
+
+        data->remaining -= direct;
+    }
+
+    // We are either seeking (null buffer) or have decoded all the requested samples during a
+    // normal read (0 remaining), so we keep the rest of the frame until next call. The leftovers
+    // are always fully consumed before decoding resumes, so once the buffer has grown to the
+    // size of the largest frame it is never reallocated again. The samples keep their original
+    // precision until the next call tells which format it wants.
+    if (direct < frameSamples)
+    {
+        const std::size_t offset = data->leftovers.size();
+        data->leftovers.resize(offset + frameSamples - direct);
+        data->bitsPerSample = bitsPerSample;
+
+        interleave(buffer, channelCount, bitsPerSample, direct, frameSamples - direct, data->leftovers.data() + offset);
     }
 
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
@@ -326,9 +378,11 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
     // Reset the callback data (the "write" callback will be called)
-    m_clientData.buffer    = nullptr;
-    m_clientData.remaining = 0;
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+    m_clientData.remaining   = 0;
     m_clientData.leftovers.clear();
+    m_clientData.leftoverOffset = 0;
 
     // FLAC decoder expects absolute sample offset, so we take the channel count out
     if (sampleOffset < m_clientData.info.sampleCount)
@@ -346,37 +400,68 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
 
         // This was re-populated during the seek, but we're skipping everything in this, so we need it emptied
         m_clientData.leftovers.clear();
+        m_clientData.leftoverOffset = 0;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    return decode(samples, nullptr, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderFlac::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return decode(nullptr, samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderFlac::isSeekExact() const
+{
+    // libFLAC lands on the exact sample, with or without a seek table
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderFlac::decode(std::int16_t* int16Samples, float* floatSamples, std::uint64_t maxCount)
 {
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
-    // If there are leftovers from previous call, use it first
-    const std::size_t left = m_clientData.leftovers.size();
+    // If there are leftovers from previous call, use them first
+    auto&             leftovers = m_clientData.leftovers;
+    const std::size_t left      = static_cast<std::size_t>(
+        std::min<std::uint64_t>(leftovers.size() - m_clientData.leftoverOffset, maxCount));
+
     if (left > 0)
     {
-        if (left > maxCount)
-        {
-            // There are more leftovers than needed
-            const auto signedMaxCount = static_cast<std::vector<std::int16_t>::difference_type>(maxCount);
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.begin() + signedMaxCount, samples);
-            m_clientData.leftovers = std::vector<std::int16_t>(m_clientData.leftovers.begin() + signedMaxCount,
-                                                               m_clientData.leftovers.end());
-            return maxCount;
-        }
+        const auto first = leftovers.begin() + static_cast<std::ptrdiff_t>(m_clientData.leftoverOffset);
+        const auto last  = first + static_cast<std::ptrdiff_t>(left);
+
+        if (floatSamples)
+            std::transform(first, last, floatSamples, floatConverter(m_clientData.bitsPerSample));
+        else
+            std::transform(first, last, int16Samples, int16Converter(m_clientData.bitsPerSample));
 
-        // We can use all the leftovers and decode new frames
-        std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
+        m_clientData.leftoverOffset += left;
     }
 
+    // There are more leftovers than needed, the cursor was just moved forward
+    if (m_clientData.leftoverOffset < leftovers.size())
+        return left;
+
+    // All the leftovers are consumed, keep their memory for the next frame
+    leftovers.clear();
+    m_clientData.leftoverOffset = 0;
+
     // Reset the data that will be used in the callback
-    m_clientData.buffer    = samples + left;
-    m_clientData.remaining = maxCount - left;
-    m_clientData.leftovers.clear();
+    m_clientData.buffer      = int16Samples ? int16Samples + left : nullptr;
+    m_clientData.floatBuffer = floatSamples ? floatSamples + left : nullptr;
+    m_clientData.remaining   = maxCount - left;
 
     // Decode frames one by one until we reach the requested sample count, the end of file or an error
     while (m_clientData.remaining > 0)
@@ -391,6 +476,10 @@ std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t max
             break;
     }
 
+    // Don't keep pointers to the caller's buffer
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+
     return maxCount - m_clientData.remaining;
 }
 
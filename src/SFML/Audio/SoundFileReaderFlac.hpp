@@ -34,6 +34,7 @@
 #include <optional>
 #include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -97,21 +98,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file as 32 bit floats
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether `seek` lands on the exact sample requested
+    ///
+    /// \return Always `true`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSeekExact() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Hold the state that is passed to the decoder callbacks
     ///
     ////////////////////////////////////////////////////////////
     struct ClientData
     {
-        InputStream*              stream{};
-        SoundFileReader::Info     info;
-        std::int16_t*             buffer{};
-        std::uint64_t             remaining{};
-        std::vector<std::int16_t> leftovers;
-        bool                      error{};
+        InputStream*             stream{};
+        SoundFileReader::Info    info;
+        std::int16_t*            buffer{};
+        float*                   floatBuffer{};
+        std::uint64_t            remaining{};
+        std::vector<FLAC__int32> leftovers;        //!< Decoded samples that didn't fit in the caller's buffer
+        std::size_t              leftoverOffset{}; //!< Position of the first unread sample in the leftovers
+        unsigned int             bitsPerSample{};  //!< Bits per sample of the leftovers
+        bool                     error{};
     };
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode samples into one of the two output formats
+    ///
+    /// \param int16Samples Array to fill with 16 bit samples, or null
+    /// \param floatSamples Array to fill with float samples, or null
+    /// \param maxCount     Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t decode(std::int16_t* int16Samples, float* floatSamples, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
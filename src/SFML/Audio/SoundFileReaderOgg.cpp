@@ -30,6 +30,8 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <ostream>
 
 #include <cassert>
@@ -215,6 +217,38 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOgg::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
+
+    // Vorbis decodes to floats, so we only have to interleave the channels
+    std::uint64_t count = 0;
+    while (count + m_channelCount <= maxCount)
+    {
+        float**    channels   = nullptr;
+        const auto framesLeft = static_cast<int>(std::min<std::uint64_t>((maxCount - count) / m_channelCount,
+                                                                             std::numeric_limits<int>::max()));
+        const long framesRead = ov_read_float(&m_vorbis, &channels, framesLeft, nullptr);
+        if (framesRead > 0)
+        {
+            for (long i = 0; i < framesRead; ++i)
+                for (unsigned int j = 0; j < m_channelCount; ++j)
+                    *samples++ = channels[j][i];
+
+            count += static_cast<std::uint64_t>(framesRead) * m_channelCount;
+        }
+        else
+        {
+            // error or end of file
+            break;
+        }
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
@@ -31,12 +31,14 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <vector>
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace
@@ -81,6 +83,59 @@ ma_result onSeek(ma_decoder* decoder, ma_int64 byteOffset, ma_seek_origin origin
             return MA_ERROR;
     }
 }
+
+std::uint64_t readFrames(ma_decoder&   decoder,
+                         ma_format     decoderFormat,
+                         void*         samples,
+                         ma_format     format,
+                         std::uint64_t maxCount)
+{
+    const ma_uint32 channelCount = decoder.outputChannels;
+    ma_uint64       framesRead{};
+
+    if (decoderFormat == format)
+    {
+        // The file is stored in the requested format, decode straight into the output
+        if (const ma_result result = ma_decoder_read_pcm_frames(&decoder, samples, maxCount / channelCount, &framesRead);
+            (result != MA_SUCCESS) && (result != MA_AT_END))
+            sf::err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+
+        return framesRead * channelCount;
+    }
+
+    // Otherwise decode blocks in the stored format and convert them directly to the requested one
+    std::array<std::uint8_t, 16384> block{};
+
+    const ma_uint64 blockFrames = block.size() / ma_get_bytes_per_frame(decoderFormat, channelCount);
+    const ma_uint64 frameCount  = maxCount / channelCount;
+    auto*           output      = static_cast<std::uint8_t*>(samples);
+
+    while (framesRead < frameCount)
+    {
+        ma_uint64 blockRead{};
+
+        if (const ma_result result = ma_decoder_read_pcm_frames(&decoder,
+                                                                block.data(),
+                                                                std::min(blockFrames, frameCount - framesRead),
+                                                                &blockRead);
+            result != MA_SUCCESS && result != MA_AT_END)
+            sf::err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
+
+        if (blockRead == 0)
+            break;
+
+        ma_pcm_convert(output + framesRead * ma_get_bytes_per_frame(format, channelCount),
+                       format,
+                       block.data(),
+                       decoderFormat,
+                       blockRead * channelCount,
+                       ma_dither_mode_none);
+
+        framesRead += blockRead;
+    }
+
+    return framesRead * channelCount;
+}
 } // namespace
 
 namespace sf::priv
@@ -130,9 +185,9 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
         m_decoder.emplace();
     }
 
+    // Keep the samples in the format they are stored in, read() and readFloat() convert them as needed
     auto config           = ma_decoder_config_init_default();
     config.encodingFormat = ma_encoding_format_wav;
-    config.format         = ma_format_s16;
 
     if (const ma_result result = ma_decoder_init(&onRead, &onSeek, &stream, &config, &*m_decoder); result != MA_SUCCESS)
     {
@@ -148,11 +203,10 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
         return std::nullopt;
     }
 
-    auto                       format = ma_format_unknown;
     ma_uint32                  sampleRate{};
     std::array<ma_channel, 20> channelMap{};
     if (const ma_result result = ma_decoder_get_data_format(&*m_decoder,
-                                                            &format,
+                                                            &m_format,
                                                             &m_channelCount,
                                                             &sampleRate,
                                                             channelMap.data(),
@@ -189,13 +243,24 @@ std::uint64_t SoundFileReaderWav::read(std::int16_t* samples, std::uint64_t maxC
 {
     assert(m_decoder && "wav decoder not initialized. Call SoundFileReaderWav::open() to initialize it.");
 
-    ma_uint64 framesRead{};
+    return readFrames(*m_decoder, m_format, samples, ma_format_s16, maxCount);
+}
 
-    if (const ma_result result = ma_decoder_read_pcm_frames(&*m_decoder, samples, maxCount / m_channelCount, &framesRead);
-        result != MA_SUCCESS)
-        err() << "Failed to read from wav sound stream: " << ma_result_description(result) << std::endl;
 
-    return framesRead * m_channelCount;
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_decoder && "wav decoder not initialized. Call SoundFileReaderWav::open() to initialize it.");
+
+    return readFrames(*m_decoder, m_format, samples, ma_format_f32, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderWav::isSeekExact() const
+{
+    // miniaudio seeks to the exact PCM frame
+    return true;
 }
 
 } // namespace sf::priv
@@ -28,14 +28,18 @@
 #include <SFML/Audio/SoundRecorder.hpp>
 
 #include <SFML/System/Err.hpp>
-#include <SFML/System/Sleep.hpp>
 
 #include <miniaudio.h>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <ostream>
+#include <thread>
 
 #include <cassert>
 #include <cstring>
@@ -67,6 +71,11 @@ struct SoundRecorder::Impl
         // (Re-)create the capture device
         if (captureDevice)
         {
+            // Join the processing thread first, it may still be using the device
+            if (ma_device_is_started(&*captureDevice))
+                (void)ma_device_stop(&*captureDevice);
+
+            stopProcessor();
             ma_device_uninit(&*captureDevice);
         }
         else
@@ -84,6 +93,13 @@ struct SoundRecorder::Impl
         {
             auto& impl = *static_cast<Impl*>(device->pUserData);
 
+            // With a processing thread, only hand the samples over to it
+            if (!impl.ring.empty())
+            {
+                impl.writeToRing(static_cast<const std::int16_t*>(input), frameCount * impl.channelCount);
+                return;
+            }
+
             // Copy the new samples into our temporary buffer
             impl.samples.resize(frameCount * impl.channelCount);
             std::memcpy(impl.samples.data(), input, frameCount * impl.channelCount * sizeof(std::int16_t));
@@ -110,6 +126,108 @@ struct SoundRecorder::Impl
         return true;
     }
 
+    void startProcessor()
+    {
+        // The ring holds whole blocks, so that a block never wraps around its end
+        const std::size_t blockSampleCount = processingBlockSize * channelCount;
+        const std::size_t blockCount       = std::max<std::size_t>((sampleRate + processingBlockSize - 1) /
+                                                                    processingBlockSize,
+                                                                8);
+
+        ring.assign(blockSampleCount * blockCount, 0);
+        writePosition = 0;
+        readPosition  = 0;
+        overflowCount = 0;
+        exitProcessor = false;
+        processor     = std::thread(&Impl::runProcessor, this);
+    }
+
+    void stopProcessor()
+    {
+        if (!processor.joinable())
+            return;
+
+        // The processing thread delivers what is left in the ring before exiting
+        {
+            const std::lock_guard lock(processorMutex);
+            exitProcessor = true;
+        }
+
+        processorCondition.notify_one();
+        processor.join();
+        ring = {};
+
+        if (const std::uint64_t overflow = overflowCount; overflow > 0)
+            err() << "Audio capture buffer overflowed, " << overflow
+                  << " samples were dropped because onProcessSamples could not keep up" << std::endl;
+    }
+
+    void writeToRing(const std::int16_t* input, std::size_t sampleCount)
+    {
+        // Called on the capture thread: never wait for the processing thread, drop what doesn't fit
+        const std::uint64_t write = writePosition.load(std::memory_order_relaxed);
+        const std::uint64_t free  = ring.size() - (write - readPosition.load(std::memory_order_acquire));
+        const auto          count = static_cast<std::size_t>(std::min<std::uint64_t>(sampleCount, free));
+        const auto          index = static_cast<std::size_t>(write % ring.size());
+        const std::size_t   first = std::min(count, ring.size() - index);
+
+        std::memcpy(ring.data() + index, input, first * sizeof(std::int16_t));
+        std::memcpy(ring.data(), input + first, (count - first) * sizeof(std::int16_t));
+
+        overflowCount.fetch_add(sampleCount - count, std::memory_order_relaxed);
+        writePosition.store(write + count);
+
+        // Wake the processing thread up if it waits for the block that was just completed. The mutex
+        // is not taken, so that the capture thread never blocks: a notification sent between the check
+        // and the wait of the processing thread is lost, its wait timeout catches up with it.
+        const std::size_t blockSampleCount = processingBlockSize * channelCount;
+        if (processorWaiting && ((write + count - readPosition.load(std::memory_order_acquire)) >= blockSampleCount))
+            processorCondition.notify_one();
+    }
+
+    void runProcessor()
+    {
+        const std::size_t blockSampleCount = processingBlockSize * channelCount;
+
+        // The capture thread notifies without the mutex, a lost notification delays a block by this much at most
+        const auto timeout = std::max(std::chrono::microseconds(1000),
+                                      std::chrono::microseconds(std::uint64_t{processingBlockSize} * 1000000 / sampleRate));
+
+        while (true)
+        {
+            const std::uint64_t read = readPosition.load(std::memory_order_relaxed);
+
+            // Wait until the capture thread has written a whole block, or until we are asked to exit
+            {
+                std::unique_lock lock(processorMutex);
+                processorWaiting = true;
+                while (!exitProcessor && ((writePosition - read) < blockSampleCount))
+                    processorCondition.wait_for(lock, timeout);
+                processorWaiting = false;
+            }
+
+            // The capture device is stopped before the exit request, so everything it captured is delivered
+            const std::uint64_t available = writePosition.load(std::memory_order_acquire) - read;
+            const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(available, blockSampleCount));
+
+            if (count == 0)
+                return;
+
+            // Blocks are delivered in place, the capture thread can't reuse them until the read position moves
+            const bool keepRecording = owner->onProcessSamples(ring.data() + read % ring.size(), count);
+            readPosition.store(read + count, std::memory_order_release);
+
+            if (!keepRecording)
+            {
+                // If the derived class wants to stop, stop the capture
+                if (const auto result = ma_device_stop(&*captureDevice); result != MA_SUCCESS)
+                    err() << "Failed to stop audio capture device: " << ma_result_description(result) << std::endl;
+
+                return;
+            }
+        }
+    }
+
     static std::vector<ma_device_info> getAvailableDevices()
     {
         std::vector<ma_device_info> deviceList;
@@ -147,15 +265,25 @@ struct SoundRecorder::Impl
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    SoundRecorder* const      owner;                          //!< Owning SoundRecorder object
-    std::optional<ma_log>     log;                            //!< The miniaudio log
-    std::optional<ma_context> context;                        //!< The miniaudio context
-    std::optional<ma_device>  captureDevice;                  //!< The miniaudio capture device
-    std::string               deviceName{getDefaultDevice()}; //!< Name of the audio capture device
-    unsigned int              channelCount{1};                //!< Number of recording channels
-    unsigned int              sampleRate{44100};              //!< Sample rate
-    std::vector<std::int16_t> samples;                        //!< Buffer to store captured samples
-    std::vector<SoundChannel> channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+    SoundRecorder* const       owner;                          //!< Owning SoundRecorder object
+    std::optional<ma_log>      log;                            //!< The miniaudio log
+    std::optional<ma_context>  context;                        //!< The miniaudio context
+    std::optional<ma_device>   captureDevice;                  //!< The miniaudio capture device
+    std::string                deviceName{getDefaultDevice()}; //!< Name of the audio capture device
+    unsigned int               channelCount{1};                //!< Number of recording channels
+    unsigned int               sampleRate{44100};              //!< Sample rate
+    std::vector<std::int16_t>  samples;                        //!< Buffer to store captured samples
+    std::vector<SoundChannel>  channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+    std::size_t                processingBlockSize{};          //!< Frames per block delivered by the processing thread
+    std::vector<std::int16_t>  ring;                           //!< Samples waiting for the processing thread
+    std::atomic<std::uint64_t> writePosition{};                //!< Samples written to the ring by the capture thread
+    std::atomic<std::uint64_t> readPosition{};                 //!< Number of samples delivered by the processing thread
+    std::atomic<std::uint64_t> overflowCount{};                //!< Number of samples dropped because the ring was full
+    bool                       exitProcessor{};                //!< Request for the processing thread to exit
+    std::atomic<bool>          processorWaiting{};             //!< Is the processing thread waiting for a block?
+    std::mutex                 processorMutex;                 //!< Mutex protecting the wait of the processing thread
+    std::condition_variable    processorCondition;             //!< Wakes the processing thread up
+    std::thread                processor;                      //!< Thread calling onProcessSamples with blocks
 };
 
 
@@ -251,6 +379,9 @@ SoundRecorder::~SoundRecorder()
            "You must call stop() in the destructor of your derived class, so that the "
            "capture device is stopped before your object is destroyed.");
 
+    // Join a processing thread that stopped the capture itself, before it can touch a destroyed device
+    m_impl->stopProcessor();
+
     // Destroy the capture device
     if (m_impl->captureDevice)
         ma_device_uninit(&*m_impl->captureDevice);
@@ -303,12 +434,20 @@ bool SoundRecorder::start(unsigned int sampleRate)
         return false;
     }
 
+    // A processing thread that stopped the capture itself is still waiting to be joined
+    m_impl->stopProcessor();
+
     // Notify derived class
     if (onStart())
     {
+        // Set up the ring before the capture thread can write to it
+        if (m_impl->processingBlockSize > 0)
+            m_impl->startProcessor();
+
         // Start the capture
         if (const auto result = ma_device_start(&*m_impl->captureDevice); result != MA_SUCCESS)
         {
+            m_impl->stopProcessor();
             err() << "Failed to start audio capture device: " << ma_result_description(result) << std::endl;
             return false;
         }
@@ -333,9 +472,15 @@ void SoundRecorder::stop()
             return;
         }
 
+        // Deliver the samples still in the ring
+        m_impl->stopProcessor();
+
         // Notify derived class
         onStop();
     }
+
+    // The processing thread may have stopped the capture device itself
+    m_impl->stopProcessor();
 }
 
 
@@ -443,6 +588,33 @@ const std::vector<SoundChannel>& SoundRecorder::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundRecorder::setProcessingBlockSize(std::size_t frameCount)
+{
+    if (m_impl->captureDevice && ma_device_is_started(&*m_impl->captureDevice))
+    {
+        err() << "Cannot change the processing block size while recording" << std::endl;
+        return;
+    }
+
+    m_impl->processingBlockSize = frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundRecorder::getProcessingBlockSize() const
+{
+    return m_impl->processingBlockSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundRecorder::getOverflowCount() const
+{
+    return m_impl->overflowCount;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundRecorder::isAvailable()
 {
@@ -88,60 +88,79 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
 
     static ma_result read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead)
     {
-        auto& impl  = *static_cast<Impl*>(dataSource);
-        auto* owner = impl.owner;
+        auto&      impl       = *static_cast<Impl*>(dataSource);
+        auto*      owner      = impl.owner;
+        auto*      output     = static_cast<std::uint8_t*>(framesOut);
+        const auto sampleSize = impl.getSampleSize();
 
-        // Try to fill our buffer with new samples if the source is still willing to stream data
-        if (impl.sampleBuffer.empty() && impl.streaming)
+        *framesRead = 0;
+
+        // Try to get new samples if the source is still willing to stream data
+        if ((impl.chunkCursor >= impl.chunkSampleCount) && impl.streaming)
         {
             Chunk chunk;
 
             impl.streaming = owner->onGetData(chunk);
 
-            if (chunk.samples && chunk.sampleCount)
+            impl.chunkSamples     = nullptr;
+            impl.chunkSampleCount = 0;
+            impl.chunkCursor      = 0;
+
+            // The sample pointer that the source has to fill depends on the format of the stream
+            const auto* samples = impl.sampleFormat == SampleFormat::Float32
+                                      ? reinterpret_cast<const std::uint8_t*>(chunk.floatSamples)
+                                      : reinterpret_cast<const std::uint8_t*>(chunk.samples);
+
+            if (samples && chunk.sampleCount)
             {
-                impl.sampleBuffer.assign(chunk.samples, chunk.samples + chunk.sampleCount);
-                impl.sampleBufferCursor = 0;
+                if (chunk.persistent)
+                {
+                    // The source keeps the samples alive until we ask for more, we can read them in place
+                    impl.chunkSamples     = samples;
+                    impl.chunkSampleCount = chunk.sampleCount;
+                }
+                else
+                {
+                    // Write what fits directly to the output, and only keep a copy of the rest
+                    *framesRead = std::min<ma_uint64>(frameCount, chunk.sampleCount / impl.channelCount);
+
+                    const auto sampleCount = static_cast<std::size_t>(*framesRead * impl.channelCount);
+                    std::memcpy(output, samples, sampleCount * sampleSize);
+
+                    impl.sampleBuffer.assign(samples + sampleCount * sampleSize,
+                                             samples + chunk.sampleCount * sampleSize);
+                    impl.chunkSamples     = impl.sampleBuffer.data();
+                    impl.chunkSampleCount = chunk.sampleCount - sampleCount;
+                    impl.samplesProcessed += sampleCount;
+                }
             }
         }
 
-        // Push the samples to miniaudio
-        if (!impl.sampleBuffer.empty())
+        // Push the remaining samples of the current chunk to miniaudio
+        if ((*framesRead == 0) && (impl.chunkCursor < impl.chunkSampleCount))
         {
             // Determine how many frames we can read
             *framesRead = std::min<ma_uint64>(frameCount,
-                                              (impl.sampleBuffer.size() - impl.sampleBufferCursor) / impl.channelCount);
+                                              (impl.chunkSampleCount - impl.chunkCursor) / impl.channelCount);
 
-            const auto sampleCount = *framesRead * impl.channelCount;
+            const auto sampleCount = static_cast<std::size_t>(*framesRead * impl.channelCount);
 
             // Copy the samples to the output
-            std::memcpy(framesOut,
-                        impl.sampleBuffer.data() + impl.sampleBufferCursor,
-                        static_cast<std::size_t>(sampleCount) * sizeof(impl.sampleBuffer[0]));
+            std::memcpy(output, impl.chunkSamples + impl.chunkCursor * sampleSize, sampleCount * sampleSize);
 
-            impl.sampleBufferCursor += static_cast<std::size_t>(sampleCount);
+            impl.chunkCursor += sampleCount;
             impl.samplesProcessed += sampleCount;
+        }
 
-            if (impl.sampleBufferCursor >= impl.sampleBuffer.size())
+        // If we are looping and at the end of the loop, set the cursor back to the beginning of the loop
+        if ((*framesRead != 0) && (impl.chunkCursor >= impl.chunkSampleCount) && !impl.streaming && impl.loop)
+        {
+            if (const auto seekPositionAfterLoop = owner->onLoop())
             {
-                impl.sampleBuffer.clear();
-                impl.sampleBufferCursor = 0;
-
-                // If we are looping and at the end of the loop, set the cursor back to the beginning of the loop
-                if (!impl.streaming && impl.loop)
-                {
-                    if (const auto seekPositionAfterLoop = owner->onLoop())
-                    {
-                        impl.streaming        = true;
-                        impl.samplesProcessed = *seekPositionAfterLoop;
-                    }
-                }
+                impl.streaming        = true;
+                impl.samplesProcessed = *seekPositionAfterLoop;
             }
         }
-        else
-        {
-            *framesRead = 0;
-        }
 
         return MA_SUCCESS;
     }
@@ -151,10 +170,11 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
         auto& impl  = *static_cast<Impl*>(dataSource);
         auto* owner = impl.owner;
 
-        impl.streaming = true;
-        impl.sampleBuffer.clear();
-        impl.sampleBufferCursor = 0;
-        impl.samplesProcessed   = frameIndex * impl.channelCount;
+        impl.streaming        = true;
+        impl.chunkSamples     = nullptr;
+        impl.chunkSampleCount = 0;
+        impl.chunkCursor      = 0;
+        impl.samplesProcessed = frameIndex * impl.channelCount;
 
         if (impl.sampleRate != 0)
         {
@@ -178,7 +198,7 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
         const auto& impl = *static_cast<const Impl*>(dataSource);
 
         // If we don't have valid values yet, initialize with defaults so sound creation doesn't fail
-        *format     = ma_format_s16;
+        *format     = priv::MiniaudioUtils::sampleFormatToMiniaudioFormat(impl.sampleFormat);
         *channels   = impl.channelCount ? impl.channelCount : 1;
         *sampleRate = impl.sampleRate ? impl.sampleRate : 44100;
 
@@ -207,19 +227,27 @@ struct SoundStream::Impl : priv::MiniaudioUtils::SoundBase
         return MA_SUCCESS;
     }
 
+    [[nodiscard]] std::size_t getSampleSize() const
+    {
+        return sampleFormat == SampleFormat::Float32 ? sizeof(float) : sizeof(std::int16_t);
+    }
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     static constexpr ma_data_source_vtable vtable{read, seek, getFormat, getCursor, getLength, setLooping, /* flags */ 0};
-    SoundStream*                           owner;        //!< Owning SoundStream object
-    std::vector<std::int16_t>              sampleBuffer; //!< Our temporary sample buffer
-    std::size_t               sampleBufferCursor{};      //!< The current read position in the temporary sample buffer
-    std::uint64_t             samplesProcessed{};        //!< Number of samples processed since beginning of the stream
-    unsigned int              channelCount{};            //!< Number of channels (1 = mono, 2 = stereo, ...)
-    unsigned int              sampleRate{};              //!< Frequency (samples / second)
-    std::vector<SoundChannel> channelMap;                //!< The map of position in sample frame to sound channel
-    bool                      loop{};                    //!< Loop flag (true to loop, false to play once)
-    bool                      streaming{true};           //!< True if we are still streaming samples from the source
+    SoundStream*                           owner;              //!< Owning SoundStream object
+    std::vector<std::uint8_t>              sampleBuffer;       //!< Copy of the unread part of non-persistent chunks
+    const std::uint8_t*                    chunkSamples{};     //!< Samples of the chunk being played
+    std::size_t                            chunkSampleCount{}; //!< Number of samples in the chunk being played
+    std::size_t                            chunkCursor{};      //!< The current read position in the chunk being played
+    std::uint64_t                          samplesProcessed{}; //!< Number of samples processed since beginning of the stream
+    unsigned int                           channelCount{};     //!< Number of channels (1 = mono, 2 = stereo, ...)
+    unsigned int                           sampleRate{};       //!< Frequency (samples / second)
+    SampleFormat                           sampleFormat{SampleFormat::Int16}; //!< Format of the streamed samples
+    std::vector<SoundChannel>              channelMap;      //!< The map of position in sample frame to sound channel
+    bool                                   loop{};          //!< Loop flag (true to loop, false to play once)
+    bool                                   streaming{true}; //!< True if we are still streaming samples from the source
 };
 
 
@@ -257,12 +285,19 @@ SoundStream& SoundStream::operator=(SoundStream&& rhs) noexcept
 
 
 ////////////////////////////////////////////////////////////
-void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap)
+void SoundStream::initialize(unsigned int                     channelCount,
+                             unsigned int                     sampleRate,
+                             const std::vector<SoundChannel>& channelMap,
+                             SampleFormat                     sampleFormat)
 {
     m_impl->channelCount     = channelCount;
     m_impl->sampleRate       = sampleRate;
+    m_impl->sampleFormat     = sampleFormat;
     m_impl->channelMap       = channelMap;
     m_impl->samplesProcessed = 0;
+    m_impl->chunkSamples     = nullptr;
+    m_impl->chunkSampleCount = 0;
+    m_impl->chunkCursor      = 0;
 
     m_impl->deinitialize();
     m_impl->initialize();
@@ -337,6 +372,13 @@ std::vector<SoundChannel> SoundStream::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+SampleFormat SoundStream::getSampleFormat() const
+{
+    return m_impl->sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundStream::Status SoundStream::getStatus() const
 {
@@ -355,10 +397,11 @@ void SoundStream::setPlayingOffset(Time timeOffset)
 
     const auto frameIndex = priv::MiniaudioUtils::getFrameIndex(m_impl->sound, timeOffset);
 
-    m_impl->streaming = true;
-    m_impl->sampleBuffer.clear();
-    m_impl->sampleBufferCursor = 0;
-    m_impl->samplesProcessed   = frameIndex * m_impl->channelCount;
+    m_impl->streaming        = true;
+    m_impl->chunkSamples     = nullptr;
+    m_impl->chunkSampleCount = 0;
+    m_impl->chunkCursor      = 0;
+    m_impl->samplesProcessed = frameIndex * m_impl->channelCount;
 
     onSeek(seconds(static_cast<float>(frameIndex) / static_cast<float>(m_impl->sampleRate)));
 }
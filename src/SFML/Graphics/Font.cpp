@@ -26,7 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/FontTextureSize.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -34,6 +35,8 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/ThreadPool.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -42,10 +45,22 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
-
+#include FT_MODULE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <memory>
 #include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include <cassert>
 #include <cmath>
 #include <cstring>
 
@@ -84,6 +99,284 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// Combine boldness and a pair of font glyph indices into a single 64-bit key
+std::uint64_t combine(bool bold, std::uint32_t index1, std::uint32_t index2)
+{
+    return (std::uint64_t{index1} << 32) | (std::uint64_t{bold} << 31) | index2;
+}
+
+// Size up to which the font textures grow, 0 if not overridden
+std::atomic<unsigned int> fontTextureMaximumSize{0};
+
+// Marker for glyph indices that were not looked up yet
+constexpr std::uint32_t unknownGlyphIndex = 0xFFFFFFFF;
+
+// FreeType can render signed distance fields since version 2.11
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+#define SFML_FREETYPE_HAS_SDF
+#endif
+
+// Character size at which the glyphs are rasterized in distance field mode
+constexpr unsigned int distanceFieldCharacterSize = 48;
+
+// Distance (in pixels at the reference size) covered by the distance field on each side of the glyph outlines
+constexpr unsigned int distanceFieldSpread = 8;
+
+// Set the spread of the distance field rasterizers, it is the same for all the glyphs of a font
+void setDistanceFieldSpread([[maybe_unused]] FT_Library library)
+{
+#ifdef SFML_FREETYPE_HAS_SDF
+    const FT_Int spread = distanceFieldSpread;
+    FT_Property_Set(library, "sdf", "spread", &spread);
+    FT_Property_Set(library, "bsdf", "spread", &spread);
+#endif
+}
+
+// Fragment shader turning the distance fields stored in the alpha channel back into glyphs.
+// Distances are normalized so that 0.5 is the outline of the glyph, the threshold is lowered
+// to draw the text outline, and the edge is antialiased over about one screen pixel.
+constexpr std::string_view distanceFieldFragmentShader = R"(
+uniform sampler2D texture;
+uniform float threshold;
+
+void main()
+{
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+    float smoothing = max(fwidth(distance) * 0.7, 0.001);
+    float alpha = smoothstep(threshold - smoothing, threshold + smoothing, distance);
+    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Scale the metrics of a glyph, its texture rectangle stays the same
+sf::Glyph scaleGlyph(sf::Glyph glyph, float factor)
+{
+    glyph.advance *= factor;
+    glyph.lsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.lsbDelta) * factor));
+    glyph.rsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.rsbDelta) * factor));
+    glyph.bounds.position *= factor;
+    glyph.bounds.size *= factor;
+    return glyph;
+}
+
+// Padding left around the glyphs in the textures, so that filtering doesn't pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Minimum number of glyphs worth opening a font face on another thread to preload them
+constexpr std::size_t minGlyphsPerWorker = 16;
+
+// Where a font face can be opened again, empty for fonts opened from a stream
+struct FontSource
+{
+    std::filesystem::path filename;      // Path of the font file
+    const void*           data{};        // Font file data in memory, owned by the caller
+    std::size_t           sizeInBytes{}; // Size of the font file data
+
+    [[nodiscard]] bool isEmpty() const
+    {
+        return filename.empty() && !data;
+    }
+};
+
+// FreeType handles of a thread rasterizing glyphs in parallel with the others (a face can't be shared by threads)
+struct WorkerFace
+{
+    WorkerFace() = default;
+
+    ~WorkerFace()
+    {
+        FT_Stroker_Done(stroker);
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    }
+
+    WorkerFace(const WorkerFace&)            = delete;
+    WorkerFace& operator=(const WorkerFace&) = delete;
+
+    [[nodiscard]] bool open(const FontSource& source, unsigned int characterSize)
+    {
+        if (FT_Init_FreeType(&library) != 0)
+            return false;
+
+        setDistanceFieldSpread(library);
+
+        const FT_Error error = source.data ? FT_New_Memory_Face(library,
+                                                                reinterpret_cast<const FT_Byte*>(source.data),
+                                                                static_cast<FT_Long>(source.sizeInBytes),
+                                                                0,
+                                                                &face)
+                                           : FT_New_Face(library, source.filename.string().c_str(), 0, &face);
+
+        return (error == 0) && (FT_Stroker_New(library, &stroker) == 0) &&
+               (FT_Set_Pixel_Sizes(face, 0, characterSize) == 0);
+    }
+
+    FT_Library library{}; // Library instance of the thread
+    FT_Face    face{};    // Font face of the thread, set to the character size of the glyphs
+    FT_Stroker stroker{}; // Stroker of the thread
+};
+
+// Glyph rasterized with the padding, but not placed in a texture yet
+struct RasterizedGlyph
+{
+    sf::Glyph    glyph;           // Metrics and bounds of the glyph
+    sf::Vector2u size;            // Size of the pixels including the padding, 0 if the glyph has no pixels
+    bool         outlineFailed{}; // Was an outline requested for a glyph that can't be outlined?
+};
+
+// Glyph of preloadGlyphs, rasterized by a worker and placed in the textures by the calling thread
+struct PendingGlyph
+{
+    std::uint64_t             key{};          // Key of the glyph in the glyph table of the page
+    std::uint32_t             index{};        // Index of the glyph in the font face
+    RasterizedGlyph           rasterized;     // Rasterized glyph
+    std::vector<std::uint8_t> pixels;         // Pixels of the rasterized glyph
+    bool                      isRasterized{}; // Was the glyph rasterized by a worker?
+};
+
+// Rasterize a glyph with a face already set to the character size; the pixels are transparent white
+// with the glyph in the alpha channel, surrounded by the padding
+RasterizedGlyph rasterizeGlyph(FT_Library                 library,
+                               FT_Face                    face,
+                               FT_Stroker                 stroker,
+                               std::uint32_t              glyphIndex,
+                               bool                       bold,
+                               float                      outlineThickness,
+                               [[maybe_unused]] bool      distanceField,
+                               std::vector<std::uint8_t>& pixelBuffer)
+{
+    RasterizedGlyph result;
+    sf::Glyph&      glyph = result.glyph;
+
+    // Load the glyph corresponding to the index
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Glyph(face, glyphIndex, flags) != 0)
+        return result;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return result;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Select how the glyph is rasterized: coverage for regular glyphs, signed distances in distance field mode
+    FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#ifdef SFML_FREETYPE_HAS_SDF
+    if (distanceField)
+        renderMode = FT_RENDER_MODE_SDF;
+#endif
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, renderMode, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        result.outlineFailed = (outlineThickness != 0);
+    }
+
+    // Compute the glyph's advance offset
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    if ((bitmap.width > 0) && (bitmap.rows > 0))
+    {
+        // Leave a small padding around characters
+        const sf::Vector2u size = sf::Vector2u(bitmap.width, bitmap.rows) + 2u * sf::Vector2u(glyphPadding, glyphPadding);
+        result.size             = size;
+
+        // Compute the glyph's bounding box
+        glyph.bounds.position = sf::Vector2f(sf::Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
+        glyph.bounds.size     = sf::Vector2f(sf::Vector2u(bitmap.width, bitmap.rows));
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        pixelBuffer.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
+
+        std::uint8_t* current = pixelBuffer.data();
+        std::uint8_t* end     = current + size.x * size.y * 4;
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = glyphPadding; y < size.y - glyphPadding; ++y)
+            {
+                for (unsigned int x = glyphPadding; x < size.x - glyphPadding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index     = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - glyphPadding) / 8]) & (1 << (7 - ((x - glyphPadding) % 8))))
+                                                     ? 255
+                                                     : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bit gray levels
+            for (unsigned int y = glyphPadding; y < size.y - glyphPadding; ++y)
+            {
+                for (unsigned int x = glyphPadding; x < size.x - glyphPadding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index     = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = pixels[x - glyphPadding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return result;
+}
 } // namespace
 
 
@@ -114,10 +407,13 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    FT_Library                                       library{};       //< Pointer to the internal library interface
+    FT_StreamRec                                     streamRec{};     //< Stream rec object describing an input stream
+    FT_Face                                          face{};          //< Pointer to the internal font face
+    FT_Stroker                                       stroker{};       //< Pointer to the stroker
+    std::array<std::vector<std::uint32_t>, 0x100>    bmpGlyphIndices; //< Glyph index of each code point of the Basic Multilingual Plane, by block of 256
+    std::unordered_map<std::uint32_t, std::uint32_t> glyphIndices;    //< Glyph index of the code points outside of the BMP
+    FontSource                                       source;          //< Where other threads can open the face again
 };
 
 
@@ -172,6 +468,7 @@ bool Font::openFromFile(const std::filesystem::path& filename)
         return false;
     }
     fontHandles->face = face;
+    setDistanceFieldSpread(fontHandles->library);
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -189,7 +486,8 @@ bool Font::openFromFile(const std::filesystem::path& filename)
     }
 
     // Store the loaded font handles
-    m_fontHandles = std::move(fontHandles);
+    fontHandles->source.filename = filename;
+    m_fontHandles                = std::move(fontHandles);
 
     // Store the font information
     m_info.family = face->family_name ? face->family_name : std::string();
@@ -234,6 +532,7 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
         return false;
     }
     fontHandles->face = face;
+    setDistanceFieldSpread(fontHandles->library);
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -250,7 +549,9 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
     }
 
     // Store the loaded font handles
-    m_fontHandles = std::move(fontHandles);
+    fontHandles->source.data        = data;
+    fontHandles->source.sizeInBytes = sizeInBytes;
+    m_fontHandles                   = std::move(fontHandles);
 
     // Store the font information
     m_info.family = face->family_name ? face->family_name : std::string();
@@ -305,6 +606,7 @@ bool Font::openFromStream(InputStream& stream)
         return false;
     }
     fontHandles->face = face;
+    setDistanceFieldSpread(fontHandles->library);
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -340,13 +642,29 @@ const Font::Info& Font::getInfo() const
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
+    // In distance field mode, glyphs are scaled from the ones of the reference size
+    // (outlines are drawn by the shader from the same glyphs)
+    if (m_isDistanceField)
+    {
+        GlyphTable&         glyphs = m_distanceFieldGlyphs[characterSize];
+        const std::uint64_t key    = combine(0.f, bold, getGlyphIndex(codePoint));
+        if (const auto it = glyphs.find(key); it != glyphs.end())
+            return it->second;
+
+        GlyphTable& references = loadPage(distanceFieldCharacterSize).glyphs;
+        auto        reference  = references.find(key);
+        if (reference == references.end())
+            reference = references.emplace(key, loadGlyph(codePoint, distanceFieldCharacterSize, bold, 0)).first;
+
+        const float factor = static_cast<float>(characterSize) / static_cast<float>(distanceFieldCharacterSize);
+        return glyphs.emplace(key, scaleGlyph(reference->second, factor)).first->second;
+    }
+
     // Get the page corresponding to the character size
     GlyphTable& glyphs = loadPage(characterSize).glyphs;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness,
-                                      bold,
-                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+    const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
 
     // Search the glyph into the cache
     if (const auto it = glyphs.find(key); it != glyphs.end())
@@ -361,10 +679,148 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
 }
 
 
+////////////////////////////////////////////////////////////
+bool Font::preloadGlyphs(const String&                    characters,
+                         const std::vector<unsigned int>& characterSizes,
+                         bool                             bold,
+                         float                            outlineThickness) const
+{
+    if (!m_fontHandles)
+    {
+        err() << "Failed to preload glyphs: no font is loaded" << std::endl;
+        return false;
+    }
+
+    // In distance field mode, only the glyphs of the reference size are rasterized (without outline)
+    const std::vector<unsigned int> pageSizes = m_isDistanceField ? std::vector<unsigned int>{distanceFieldCharacterSize}
+                                                                  : characterSizes;
+    const float                     thickness = m_isDistanceField ? 0.f : outlineThickness;
+
+    // Glyphs to load for a character size, and the workers rasterizing them
+    struct Batch
+    {
+        unsigned int                   characterSize{};
+        std::vector<PendingGlyph>      glyphs;
+        std::vector<std::future<void>> workers;
+    };
+
+    std::vector<Batch> batches(pageSizes.size());
+    const FontSource&  source = m_fontHandles->source;
+    priv::ThreadPool&  pool   = priv::ThreadPool::getShared();
+
+    for (std::size_t i = 0; i < pageSizes.size(); ++i)
+    {
+        Batch& batch        = batches[i];
+        batch.characterSize = pageSizes[i];
+
+        // Collect the glyphs that are not loaded yet, once each
+        const GlyphTable&                 glyphs = loadPage(batch.characterSize).glyphs;
+        std::unordered_set<std::uint64_t> keys;
+        for (const char32_t codePoint : characters)
+        {
+            const std::uint32_t index = getGlyphIndex(codePoint);
+            const std::uint64_t key   = combine(thickness, bold, index);
+            if ((glyphs.find(key) == glyphs.end()) && keys.insert(key).second)
+            {
+                PendingGlyph& pending = batch.glyphs.emplace_back();
+                pending.key           = key;
+                pending.index         = index;
+            }
+        }
+
+        // Split the glyphs between workers that open their own face at this size (fonts
+        // opened from a stream can't be opened again, they are rasterized below)
+        if (source.isEmpty())
+            continue;
+
+        const std::size_t count       = batch.glyphs.size();
+        const std::size_t workerCount = std::min(count / minGlyphsPerWorker, std::size_t{pool.getThreadCount()});
+        for (std::size_t worker = 0; (workerCount > 1) && (worker < workerCount); ++worker)
+        {
+            PendingGlyph* const first = batch.glyphs.data() + count * worker / workerCount;
+            PendingGlyph* const last  = batch.glyphs.data() + count * (worker + 1) / workerCount;
+
+            std::packaged_task<void()> task(
+                [&source, first, last, characterSize = batch.characterSize, bold, thickness, distanceField = m_isDistanceField]
+                {
+                    WorkerFace face;
+                    if (!face.open(source, characterSize))
+                        return;
+
+                    for (PendingGlyph* pending = first; pending != last; ++pending)
+                    {
+                        pending->rasterized   = rasterizeGlyph(face.library,
+                                                             face.face,
+                                                             face.stroker,
+                                                             pending->index,
+                                                             bold,
+                                                             thickness,
+                                                             distanceField,
+                                                             pending->pixels);
+                        pending->isRasterized = true;
+                    }
+                });
+
+            batch.workers.push_back(task.get_future());
+            pool.enqueue(std::move(task));
+        }
+    }
+
+    // The workers write to the batches, wait for all of them before anything can throw
+    for (const Batch& batch : batches)
+    {
+        for (const std::future<void>& worker : batch.workers)
+            worker.wait();
+    }
+
+    for (Batch& batch : batches)
+    {
+        for (std::future<void>& worker : batch.workers)
+            worker.get();
+
+        // Rasterize the glyphs that no worker could take care of on this thread
+        Page& page = loadPage(batch.characterSize);
+        for (PendingGlyph& pending : batch.glyphs)
+        {
+            if (!pending.isRasterized && setCurrentSize(batch.characterSize))
+                pending.rasterized = rasterizeGlyph(m_fontHandles->library,
+                                                    m_fontHandles->face,
+                                                    m_fontHandles->stroker,
+                                                    pending.index,
+                                                    bold,
+                                                    thickness,
+                                                    m_isDistanceField,
+                                                    pending.pixels);
+        }
+
+        // Place the glyphs in the same order as if they were loaded one by one, and
+        // upload the glyphs added to each row of the textures at once
+        for (Atlas& atlas : page.atlases)
+            atlas.beginStaging();
+
+        for (PendingGlyph& pending : batch.glyphs)
+        {
+            if (pending.rasterized.outlineFailed)
+                err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+            if ((pending.rasterized.size.x > 0) && (pending.rasterized.size.y > 0))
+                placeGlyph(page, pending.rasterized.size, pending.pixels.data(), pending.rasterized.glyph);
+
+            page.glyphs.emplace(pending.key, pending.rasterized.glyph);
+        }
+
+        for (Atlas& atlas : page.atlases)
+            atlas.endStaging();
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(std::uint32_t codePoint) const
 {
-    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
+    return getGlyphIndex(codePoint) != 0;
 }
 
 
@@ -377,32 +833,46 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
 
-    if (face && setCurrentSize(characterSize))
-    {
-        // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
+    // Invalid font
+    if (!face)
+        return 0.f;
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+    // In distance field mode, kerning is scaled from the reference size like the glyphs
+    if (m_isDistanceField && (characterSize != distanceFieldCharacterSize))
+        return getKerning(first, second, distanceFieldCharacterSize, bold) * static_cast<float>(characterSize) /
+               static_cast<float>(distanceFieldCharacterSize);
 
-        // Get the kerning vector if present
-        FT_Vector kerning{0, 0};
-        if (FT_HAS_KERNING(face))
-            FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+    // Convert the characters to indices
+    const std::uint32_t index1 = getGlyphIndex(first);
+    const std::uint32_t index2 = getGlyphIndex(second);
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
+    // Search the pair into the cache
+    KerningTable&       kernings = loadPage(characterSize).kernings;
+    const std::uint64_t key      = combine(bold, index1, index2);
+    if (const auto it = kernings.find(key); it != kernings.end())
+        return it->second;
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / float{1 << 6});
-    }
+    if (!setCurrentSize(characterSize))
+        return 0.f;
 
-    // Invalid font
-    return 0.f;
+    // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+    const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
+    const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+
+    // Get the kerning vector if present
+    FT_Vector kerning{0, 0};
+    if (FT_HAS_KERNING(face))
+        FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+
+    // X advance is already in pixels for bitmap fonts, otherwise combine kerning with compensation deltas
+    // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+    const float offset = FT_IS_SCALABLE(face)
+                             ? std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) /
+                                          float{1 << 6})
+                             : static_cast<float>(kerning.x);
+
+    kernings.emplace(key, offset);
+    return offset;
 }
 
 
@@ -457,9 +927,18 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-const Texture& Font::getTexture(unsigned int characterSize) const
+const Texture& Font::getTexture(unsigned int characterSize, std::size_t textureIndex) const
 {
-    return loadPage(characterSize).texture;
+    const Page& page = loadPage(m_isDistanceField ? distanceFieldCharacterSize : characterSize);
+    assert(textureIndex < page.atlases.size() && "Font::getTexture() textureIndex out of range");
+    return page.atlases[textureIndex].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getTextureCount(unsigned int characterSize) const
+{
+    return loadPage(m_isDistanceField ? distanceFieldCharacterSize : characterSize).atlases.size();
 }
 
 ////////////////////////////////////////////////////////////
@@ -471,7 +950,8 @@ void Font::setSmooth(bool smooth)
 
         for (auto& [key, page] : m_pages)
         {
-            page.texture.setSmooth(m_isSmooth);
+            for (Atlas& atlas : page.atlases)
+                atlas.texture.setSmooth(m_isSmooth);
         }
     }
 }
@@ -483,6 +963,69 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+    if (enabled == m_isDistanceField)
+        return;
+
+    if (enabled && !m_distanceFieldShader)
+    {
+#ifdef SFML_FREETYPE_HAS_SDF
+        if (!Shader::isAvailable())
+        {
+            err() << "Failed to enable the font distance field mode: shaders are not supported" << std::endl;
+            return;
+        }
+
+        auto shader = std::make_shared<Shader>();
+        if (!shader->loadFromMemory(distanceFieldFragmentShader, Shader::Type::Fragment))
+        {
+            err() << "Failed to enable the font distance field mode: the shader could not be loaded" << std::endl;
+            return;
+        }
+
+        shader->setUniform("texture", Shader::CurrentTexture);
+        shader->setUniform("threshold", 0.5f);
+        m_distanceFieldShader = std::move(shader);
+#else
+        err() << "Failed to enable the font distance field mode: FreeType 2.11 or later is required" << std::endl;
+        return;
+#endif
+    }
+
+    // The glyphs loaded so far were rendered for the other mode
+    m_isDistanceField = enabled;
+    m_pages.clear();
+    m_distanceFieldGlyphs.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceField;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader() const
+{
+    return m_isDistanceField ? m_distanceFieldShader.get() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::getDistanceFieldThreshold(unsigned int characterSize, float outlineThickness) const
+{
+    // Convert the outline thickness to a distance in the fields, where 0.5 is the glyph outline
+    // and the spread is mapped to 0.5 on each side
+    const float distance = outlineThickness * static_cast<float>(distanceFieldCharacterSize) /
+                           static_cast<float>(characterSize) / static_cast<float>(distanceFieldSpread);
+    return std::max(0.5f - distance * 0.5f, 0.f);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
@@ -491,6 +1034,7 @@ void Font::cleanup()
 
     // Reset members
     m_pages.clear();
+    m_distanceFieldGlyphs.clear();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
 }
 
@@ -505,236 +1049,163 @@ Font::Page& Font::loadPage(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
-    // The glyph to return
-    Glyph glyph;
-
     // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
-
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
 
     // Set the character size
     if (!setCurrentSize(characterSize))
-        return glyph;
-
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
-
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
-
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
-    {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
-
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
-
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
-    }
+        return {};
+
+    // Rasterize the glyph corresponding to the code point
+    RasterizedGlyph rasterized = rasterizeGlyph(m_fontHandles->library,
+                                                m_fontHandles->face,
+                                                m_fontHandles->stroker,
+                                                getGlyphIndex(codePoint),
+                                                bold,
+                                                outlineThickness,
+                                                m_isDistanceField,
+                                                m_pixelBuffer);
+
+    if (rasterized.outlineFailed)
+        err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+    // Write its pixels to the texture of the page corresponding to the character size
+    if ((rasterized.size.x > 0) && (rasterized.size.y > 0))
+        placeGlyph(loadPage(characterSize), rasterized.size, m_pixelBuffer.data(), rasterized.glyph);
+
+    return rasterized.glyph;
+}
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+////////////////////////////////////////////////////////////
+void Font::placeGlyph(Page& page, Vector2u size, const std::uint8_t* pixels, Glyph& glyph) const
+{
+    // Find a good position for the new glyph into the texture
+    glyph.textureRect = findGlyphRect(page, size, glyph.textureIndex);
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
-    }
+    // Write the pixels to the texture
+    page.atlases[glyph.textureIndex].write(pixels, Vector2u(glyph.textureRect.size), Vector2u(glyph.textureRect.position));
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect.position += Vector2i(glyphPadding, glyphPadding);
+    glyph.textureRect.size -= 2 * Vector2i(glyphPadding, glyphPadding);
+}
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
 
-    Vector2u size(bitmap.width, bitmap.rows);
+////////////////////////////////////////////////////////////
+std::uint32_t Font::getGlyphIndex(std::uint32_t codePoint) const
+{
+    if (!m_fontHandles || !m_fontHandles->face)
+        return 0;
 
-    if ((size.x > 0) && (size.y > 0))
+    // Code points of the Basic Multilingual Plane are looked up in flat tables of 256 code points,
+    // allocated the first time one of their code points is requested
+    if (codePoint < 0x10000)
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
-
-        size += 2u * Vector2u(padding, padding);
-
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
-
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
-
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
+        std::vector<std::uint32_t>& indices = m_fontHandles->bmpGlyphIndices[codePoint >> 8];
+        if (indices.empty())
+            indices.resize(0x100, unknownGlyphIndex);
 
-        // Compute the glyph's bounding box
-        glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
-        glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
-
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
-
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + size.x * size.y * 4;
-
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
+        std::uint32_t& index = indices[codePoint & 0xFF];
+        if (index == unknownGlyphIndex)
+            index = FT_Get_Char_Index(m_fontHandles->face, codePoint);
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-        {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
-        {
-            // Pixels are 8 bit gray levels
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-
-        // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
+        return index;
     }
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
+    // Other code points are rare, a hash table is enough for them
+    const auto [it, inserted] = m_fontHandles->glyphIndices.try_emplace(codePoint);
+    if (inserted)
+        it->second = FT_Get_Char_Index(m_fontHandles->face, codePoint);
 
-    // Done :)
-    return glyph;
+    return it->second;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+IntRect Font::findGlyphRect(Page& page, Vector2u size, unsigned int& textureIndex) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    // Find a row that fits the glyph: rows that are either too small or too high
+    // (height ratio outside of [0.7, 1]) are not even visited, and within a texture
+    // the first row with enough horizontal space left has the best ratio
+    Atlas*                                             atlas     = nullptr;
+    std::multimap<unsigned int, std::size_t>::iterator entry;
+    const unsigned int                                 maxHeight = size.y * 10 / 7;
+    for (std::size_t i = 0; (i < page.atlases.size()) && !atlas; ++i)
     {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
-
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
-
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
-
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
-
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
+        Atlas&     candidate = page.atlases[i];
+        const auto end       = candidate.rowsByHeight.upper_bound(maxHeight);
+        for (auto it = candidate.rowsByHeight.lower_bound(size.y); it != end; ++it)
+        {
+            if (size.x <= candidate.texture.getSize().x - candidate.rows[it->second].width)
+            {
+                atlas        = &candidate;
+                entry        = it;
+                textureIndex = static_cast<unsigned int>(i);
+                break;
+            }
+        }
     }
 
     // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+    if (!atlas)
     {
+        // New rows are only added to the last texture of the page
         const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        const auto         fits      = [&](unsigned int nextRow, unsigned int textureSize)
+        { return (nextRow + rowHeight < textureSize) && (size.x < textureSize); };
+
+        // Not enough space: grow the last texture, up to the maximum size
+        const unsigned int maximumSize = priv::getFontTextureMaximumSize();
+        const unsigned int lastSize    = page.atlases.back().texture.getSize().y;
+        unsigned int       textureSize = lastSize;
+        while (!fits(page.atlases.back().nextRow, textureSize) && (textureSize < maximumSize))
+            textureSize = std::min(textureSize * 2, maximumSize);
+
+        if (fits(page.atlases.back().nextRow, textureSize))
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
-            {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
+            if (textureSize != lastSize)
+                page.atlases.back().grow(textureSize);
+        }
+        else
+        {
+            // The last texture has reached the maximum size: continue in a new texture
+            textureSize = std::min(Atlas::initialSize, maximumSize);
+            while (!fits(Atlas::firstRow, textureSize) && (textureSize < maximumSize))
+                textureSize = std::min(textureSize * 2, maximumSize);
 
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
-            }
-            else
+            if (!fits(Atlas::firstRow, textureSize))
             {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
+                // Oops, the glyph doesn't even fit in an empty texture of the maximum size...
+                err() << "Failed to add a new character to the font: the glyph is larger than the maximum texture size"
                       << std::endl;
                 return {{0, 0}, {2, 2}};
             }
+
+            const bool staging = page.atlases.back().isStaging();
+            page.atlases.emplace_back(m_isSmooth, textureSize);
+            if (staging)
+                page.atlases.back().beginStaging();
         }
 
         // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
+        atlas = &page.atlases.back();
+        atlas->rows.emplace_back(atlas->nextRow, rowHeight);
+        atlas->nextRow += rowHeight;
+        entry        = atlas->rowsByHeight.emplace(rowHeight, atlas->rows.size() - 1);
+        textureIndex = static_cast<unsigned int>(page.atlases.size() - 1);
     }
 
     // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    Row&          row = atlas->rows[entry->second];
+    const IntRect rect(Rect<unsigned int>({row.width, row.top}, size));
 
-    // Update the row information
-    row->width += size.x;
+    // Update the row information, full rows are not visited anymore
+    row.width += size.x;
+    if (atlas->isFull(row))
+        atlas->rowsByHeight.erase(entry);
 
     return rect;
 }
@@ -784,21 +1255,149 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 Font::Page::Page(bool smooth)
 {
-    // Make sure that the texture is initialized by default
-    Image image({128, 128}, Color::Transparent);
+    atlases.emplace_back(smooth, Atlas::initialSize);
+}
 
-    // Reserve a 2x2 white square for texturing underlines
-    for (unsigned int x = 0; x < 2; ++x)
-        for (unsigned int y = 0; y < 2; ++y)
-            image.setPixel({x, y}, Color::White);
 
-    // Create the texture
-    if (!texture.loadFromImage(image))
+////////////////////////////////////////////////////////////
+Font::Atlas::Atlas(bool smooth, unsigned int size)
+{
+    if (!texture.resize({size, size}))
     {
         err() << "Failed to load font page texture" << std::endl;
+        return;
     }
 
+    // Start from transparent pixels, and reserve a 2x2 white square for texturing underlines
+    std::vector<std::uint8_t> pixels(std::size_t{size} * size * 4, 0);
+    for (unsigned int y = 0; y < 2; ++y)
+        std::memset(&pixels[std::size_t{y} * size * 4], 255, 2 * 4);
+
+    texture.update(pixels.data());
     texture.setSmooth(smooth);
 }
 
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::grow(unsigned int size)
+{
+    // The staged pixels are laid out for the current size, upload them first
+    const bool wasStaging = staging;
+    endStaging();
+
+    // Create the larger texture, and swap it with the current one so that references to the texture stay valid
+    const unsigned int oldSize = texture.getSize().x;
+    Texture            newTexture;
+    if (newTexture.resize({size, size}))
+    {
+        // Clear the new area (the bottom band is the largest one), then copy the glyphs without reading them back
+        const std::vector<std::uint8_t> transparent(std::size_t{size} * (size - oldSize) * 4, 0);
+        newTexture.update(transparent.data(), {size, size - oldSize}, {0, oldSize});
+        newTexture.update(transparent.data(), {size - oldSize, oldSize}, {oldSize, 0});
+        newTexture.update(texture, {0, 0});
+        newTexture.setSmooth(texture.isSmooth());
+        texture.swap(newTexture);
+    }
+    else
+    {
+        err() << "Failed to grow font page texture" << std::endl;
+    }
+
+    if (wasStaging)
+        beginStaging();
+
+    // The rows are larger now, some of those that were full can receive glyphs again
+    rowsByHeight.clear();
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        if (!isFull(rows[i]))
+            rowsByHeight.emplace(rows[i].height, i);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::Atlas::isFull(const Row& row) const
+{
+    // Glyphs narrower than a fifth of the row height are too rare to keep visiting
+    // the row, so that the number of rows to search remains small
+    return texture.getSize().x - row.width < row.height / 5;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::beginStaging()
+{
+    staging = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::write(const std::uint8_t* glyphPixels, Vector2u size, Vector2u dest)
+{
+    if (!staging)
+    {
+        texture.update(glyphPixels, size, dest);
+        return;
+    }
+
+    // Glyphs are staged by row: the pixels of a row span from its first staged glyph to the
+    // right edge of the texture, and are as high as its highest staged glyph
+    const auto [it, inserted] = stagedRows.try_emplace(dest.y);
+    StagedRow& row            = it->second;
+    if (inserted)
+        row.left = dest.x;
+
+    const unsigned int width = texture.getSize().x - row.left;
+    if (size.y > row.height)
+    {
+        row.height = size.y;
+        row.pixels.resize(std::size_t{width} * row.height * 4, 0);
+    }
+
+    for (unsigned int y = 0; y < size.y; ++y)
+        std::memcpy(&row.pixels[(std::size_t{y} * width + dest.x - row.left) * 4],
+                    &glyphPixels[std::size_t{y} * size.x * 4],
+                    std::size_t{size.x} * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::endStaging()
+{
+    if (!staging)
+        return;
+
+    staging = false;
+
+    // Upload the glyphs staged on each row at once; the texture is still transparent
+    // around them, as nothing was written right of the row's glyphs before
+    for (const auto& [top, row] : stagedRows)
+        texture.update(row.pixels.data(), {texture.getSize().x - row.left, row.height}, {row.left, top});
+
+    stagedRows.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::Atlas::isStaging() const
+{
+    return staging;
+}
+
+
+////////////////////////////////////////////////////////////
+void priv::setFontTextureMaximumSize(unsigned int size)
+{
+    fontTextureMaximumSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int priv::getFontTextureMaximumSize()
+{
+    const unsigned int size = fontTextureMaximumSize;
+    return size ? size : Texture::getMaximumSize();
+}
+
 } // namespace sf
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Override the size up to which the font textures grow
+///
+/// The glyphs of a character size only spill into an additional
+/// texture once the last one reached this size. It is lowered by
+/// the tests, so that fonts spill without allocating textures
+/// of the maximum size.
+///
+/// \param size Maximum size of the font textures, 0 to use `Texture::getMaximumSize()`
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void setFontTextureMaximumSize(unsigned int size);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size up to which the font textures grow
+///
+/// \return Maximum size of the font textures
+///
+/// \see `setFontTextureMaximumSize`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getFontTextureMaximumSize();
+
+} // namespace sf::priv
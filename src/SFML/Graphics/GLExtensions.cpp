@@ -80,6 +80,7 @@ void extensionSanityCheck()
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_sync_dependencies);
 #endif
 }
 
@@ -168,6 +168,36 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.0 - EXT_unpack_subimage
+#define GLEXT_unpack_row_length    false
+#define GLEXT_GL_UNPACK_ROW_LENGTH 0
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object            false
+#define GLEXT_GL_PIXEL_PACK_BUFFER           0
+#define GLEXT_GL_PIXEL_PACK_BUFFER_BINDING   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER         0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER_BINDING 0
+#define GLEXT_GL_READ_ONLY                   0
+#define GLEXT_GL_STREAM_READ                 0
+#define GLEXT_glMapBuffer \
+    glMapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUnmapBuffer \
+    glUnmapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync                          false
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_TIMEOUT_EXPIRED            0
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    0
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -187,8 +217,10 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // and has to be checked for prior to use
 
 // Core since 1.1
-#define GLEXT_GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT
-#define GLEXT_GL_CLAMP           GL_CLAMP
+#define GLEXT_GL_DEPTH_COMPONENT   GL_DEPTH_COMPONENT
+#define GLEXT_GL_CLAMP             GL_CLAMP
+#define GLEXT_unpack_row_length    true
+#define GLEXT_GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -235,6 +267,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
 #define GLEXT_GL_STREAM_DRAW                   GL_STREAM_DRAW_ARB
+#define GLEXT_GL_STREAM_READ                   GL_STREAM_READ_ARB
 #define GLEXT_GL_WRITE_ONLY                    GL_WRITE_ONLY_ARB
 #define GLEXT_glBindBuffer                     glBindBufferARB
 #define GLEXT_glBufferData                     glBufferDataARB
@@ -314,6 +347,14 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB                         SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                      GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+// Buffers are bound and filled with the ARB_vertex_buffer_object entry points
+#define GLEXT_pixel_buffer_object            (GLEXT_vertex_buffer_object && SF_GLAD_GL_VERSION_2_1)
+#define GLEXT_GL_PIXEL_PACK_BUFFER           GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_PACK_BUFFER_BINDING   GL_PIXEL_PACK_BUFFER_BINDING
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER         GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER_BINDING GL_PIXEL_UNPACK_BUFFER_BINDING
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                   SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                   glBindRenderbufferEXT
@@ -372,6 +413,18 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_TIMEOUT_EXPIRED            GL_TIMEOUT_EXPIRED
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
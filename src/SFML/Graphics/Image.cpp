@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageKernels.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
@@ -35,6 +36,14 @@
 #include <SFML/System/Android/Activity.hpp>
 #include <SFML/System/Android/ResourceStream.hpp>
 #endif
+#ifdef SFML_SYSTEM_WINDOWS
+#include <SFML/System/Win32/WindowsHeader.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -44,11 +53,14 @@
 #include <algorithm>
 #include <iomanip>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <string>
 #include <utility>
 
 #include <cassert>
+#include <climits>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -92,6 +104,116 @@ struct StbDeleter
     }
 };
 using StbPtr = std::unique_ptr<stbi_uc, StbDeleter>;
+
+// Allocate a pixel buffer that can be released like the ones decoded by stb_image (which uses malloc)
+std::uint8_t* allocatePixels(std::size_t size)
+{
+    auto* pixels = static_cast<std::uint8_t*>(std::malloc(size)); // NOLINT(cppcoreguidelines-no-malloc)
+    if (!pixels)
+        throw std::bad_alloc();
+
+    return pixels;
+}
+
+// Files smaller than this are read with stdio, mapping them costs more than it saves
+constexpr std::size_t minimumMappedFileSize = 64 * 1024;
+
+// Read-only view of a whole file, mapped in memory
+//
+// On POSIX systems, reading a mapped page that lies beyond the end of the file raises SIGBUS.
+// The size is checked again once the file is mapped, so a file that was truncated in between
+// is read with stdio instead, but a file truncated while it is being decoded still crashes the
+// process: images must not be truncated while they are loaded. Windows refuses to truncate
+// a file that is mapped.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& filename)
+    {
+#ifdef SFML_SYSTEM_WINDOWS
+        const HANDLE file = CreateFileW(filename.c_str(),
+                                        GENERIC_READ,
+                                        FILE_SHARE_READ,
+                                        nullptr,
+                                        OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL,
+                                        nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && (static_cast<std::size_t>(size.QuadPart) >= minimumMappedFileSize))
+        {
+            // The mapping and the view keep the file open, its handles can be closed right away
+            if (const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+            {
+                m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                m_size = m_data ? static_cast<std::size_t>(size.QuadPart) : 0;
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+#else
+        const int file = open(filename.c_str(), O_RDONLY);
+        if (file == -1)
+            return;
+
+        struct stat status{};
+        if ((fstat(file, &status) == 0) && S_ISREG(status.st_mode) &&
+            (static_cast<std::size_t>(status.st_size) >= minimumMappedFileSize))
+        {
+            // The mapping keeps the file open, its descriptor can be closed right away
+            const auto size = static_cast<std::size_t>(status.st_size);
+            void*      data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED)
+            {
+                // Don't use the mapping if the file was truncated before it was mapped
+                if ((fstat(file, &status) == 0) && (static_cast<std::size_t>(status.st_size) == size))
+                {
+                    m_data = data;
+                    m_size = size;
+                }
+                else
+                {
+                    munmap(data, size);
+                }
+            }
+        }
+
+        close(file);
+#endif
+    }
+
+    ~MappedFile()
+    {
+        if (!m_data)
+            return;
+
+#ifdef SFML_SYSTEM_WINDOWS
+        UnmapViewOfFile(m_data);
+#else
+        munmap(m_data, m_size);
+#endif
+    }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const stbi_uc* getData() const
+    {
+        return static_cast<const stbi_uc*>(m_data);
+    }
+
+    [[nodiscard]] std::size_t getSize() const
+    {
+        return m_size;
+    }
+
+private:
+    void*       m_data{}; //!< Address of the mapped file, or nullptr if it couldn't be mapped
+    std::size_t m_size{}; //!< Size of the mapped file, in bytes
+};
 } // namespace
 
 
@@ -135,17 +257,59 @@ Image::Image(InputStream& stream)
 }
 
 
+////////////////////////////////////////////////////////////
+Image::~Image() = default;
+
+
+////////////////////////////////////////////////////////////
+Image::Image(const Image& copy) : m_size(copy.m_size)
+{
+    if (copy.m_pixels)
+    {
+        const std::size_t byteCount = std::size_t{m_size.x} * m_size.y * 4;
+        m_pixels.reset(allocatePixels(byteCount));
+        std::memcpy(m_pixels.get(), copy.m_pixels.get(), byteCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Image& Image::operator=(const Image& right)
+{
+    Image temp(right);
+    std::swap(m_size, temp.m_size);
+    std::swap(m_pixels, temp.m_pixels);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Image::Image(Image&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Image& Image::operator=(Image&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void Image::PixelsDeleter::operator()(std::uint8_t* pixels) const
+{
+    stbi_image_free(pixels);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Image::resize(Vector2u size, Color color)
 {
     if (size.x && size.y)
     {
         // Create a new pixel buffer first for exception safety's sake
-        std::vector<std::uint8_t> newPixels(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+        PixelsPtr         newPixels(allocatePixels(byteCount));
 
         // Fill it with the specified color
-        std::uint8_t* ptr = newPixels.data();
-        std::uint8_t* end = ptr + newPixels.size();
+        std::uint8_t* ptr = newPixels.get();
+        std::uint8_t* end = ptr + byteCount;
         while (ptr < end)
         {
             *ptr++ = color.r;
@@ -163,7 +327,7 @@ void Image::resize(Vector2u size, Color color)
     else
     {
         // Dump the pixel buffer
-        std::vector<std::uint8_t>().swap(m_pixels);
+        m_pixels.reset();
 
         // Assign the new size
         m_size = {};
@@ -177,7 +341,9 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
     if (pixels && size.x && size.y)
     {
         // Create a new pixel buffer first for exception safety's sake
-        std::vector<std::uint8_t> newPixels(pixels, pixels + size.x * size.y * 4);
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+        PixelsPtr         newPixels(allocatePixels(byteCount));
+        std::memcpy(newPixels.get(), pixels, byteCount);
 
         // Commit the new pixel buffer
         m_pixels = std::move(newPixels);
@@ -188,7 +354,7 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
     else
     {
         // Dump the pixel buffer
-        std::vector<std::uint8_t>().swap(m_pixels);
+        m_pixels.reset();
 
         // Assign the new size
         m_size = {};
@@ -209,22 +375,30 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
 
 #endif
 
-    // Clear the array (just in case)
-    m_pixels.clear();
-
     // Load the image and get a pointer to the pixels in memory
-    int        width    = 0;
-    int        height   = 0;
-    int        channels = 0;
-    const auto ptr      = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha));
+    // (decode straight from the mapped file when possible, rather than reading it through a buffer)
+    int              width    = 0;
+    int              height   = 0;
+    int              channels = 0;
+    StbPtr           ptr;
+    const MappedFile file(filename);
+    if (file.getData() && (file.getSize() <= INT_MAX))
+        ptr = StbPtr(stbi_load_from_memory(file.getData(),
+                                           static_cast<int>(file.getSize()),
+                                           &width,
+                                           &height,
+                                           &channels,
+                                           STBI_rgb_alpha));
+    else
+        ptr = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha));
 
     if (ptr)
     {
         // Assign the image properties
         m_size = Vector2u(Vector2i(width, height));
 
-        // Copy the loaded pixels to the pixel buffer
-        m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+        // Adopt the loaded pixels, no copy needed
+        m_pixels.reset(ptr.release());
 
         return true;
     }
@@ -243,15 +417,12 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
     // Check input parameters
     if (data && size)
     {
-        // Clear the array (just in case)
-        m_pixels.clear();
-
         // Load the image and get a pointer to the pixels in memory
         int         width    = 0;
         int         height   = 0;
         int         channels = 0;
         const auto* buffer   = static_cast<const unsigned char*>(data);
-        const auto  ptr      = StbPtr(
+        auto        ptr      = StbPtr(
             stbi_load_from_memory(buffer, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha));
 
         if (ptr)
@@ -259,8 +430,8 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
             // Assign the image properties
             m_size = Vector2u(Vector2i(width, height));
 
-            // Copy the loaded pixels to the pixel buffer
-            m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+            // Adopt the loaded pixels, no copy needed
+            m_pixels.reset(ptr.release());
 
             return true;
         }
@@ -279,9 +450,6 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
 ////////////////////////////////////////////////////////////
 bool Image::loadFromStream(InputStream& stream)
 {
-    // Clear the array (just in case)
-    m_pixels.clear();
-
     // Make sure that the stream's reading position is at the beginning
     if (!stream.seek(0).has_value())
     {
@@ -299,15 +467,15 @@ bool Image::loadFromStream(InputStream& stream)
     int        width    = 0;
     int        height   = 0;
     int        channels = 0;
-    const auto ptr = StbPtr(stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha));
+    auto       ptr = StbPtr(stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha));
 
     if (ptr)
     {
         // Assign the image properties
         m_size = Vector2u(Vector2i(width, height));
 
-        // Copy the loaded pixels to the pixel buffer
-        m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+        // Adopt the loaded pixels, no copy needed
+        m_pixels.reset(ptr.release());
 
         return true;
     }
@@ -322,7 +490,7 @@ bool Image::loadFromStream(InputStream& stream)
 bool Image::saveToFile(const std::filesystem::path& filename) const
 {
     // Make sure the image is not empty
-    if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
+    if (m_pixels && m_size.x > 0 && m_size.y > 0)
     {
         // Deduce the image type from its extension
 
@@ -333,25 +501,25 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
         if (extension == ".bmp")
         {
             // BMP format
-            if (stbi_write_bmp(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_bmp(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return true;
         }
         else if (extension == ".tga")
         {
             // TGA format
-            if (stbi_write_tga(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_tga(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return true;
         }
         else if (extension == ".png")
         {
             // PNG format
-            if (stbi_write_png(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
+            if (stbi_write_png(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get(), 0))
                 return true;
         }
         else if (extension == ".jpg" || extension == ".jpeg")
         {
             // JPG format
-            if (stbi_write_jpg(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get(), 90))
                 return true;
         }
         else
@@ -369,7 +537,7 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
 std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view format) const
 {
     // Make sure the image is not empty
-    if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
+    if (m_pixels && m_size.x > 0 && m_size.y > 0)
     {
         // Choose function based on format
         const std::string specified     = toLower(std::string(format));
@@ -380,25 +548,25 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
         if (specified == "bmp")
         {
             // BMP format
-            if (stbi_write_bmp_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_bmp_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return buffer;
         }
         else if (specified == "tga")
         {
             // TGA format
-            if (stbi_write_tga_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_tga_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return buffer;
         }
         else if (specified == "png")
         {
             // PNG format
-            if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
+            if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get(), 0))
                 return buffer;
         }
         else if (specified == "jpg" || specified == "jpeg")
         {
             // JPG format
-            if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get(), 90))
                 return buffer;
         }
     }
@@ -419,17 +587,10 @@ Vector2u Image::getSize() const
 void Image::createMaskFromColor(Color color, std::uint8_t alpha)
 {
     // Make sure that the image is not empty
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
         // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr < end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        priv::maskFromColor(m_pixels.get(), std::size_t{m_size.x} * m_size.y, color, alpha);
     }
 }
 
@@ -473,36 +634,16 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     const unsigned int srcStride = source.m_size.x * 4;
     const unsigned int dstStride = m_size.x * 4;
 
-    const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
-    std::uint8_t*       dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
+    const std::uint8_t* srcPixels = source.m_pixels.get() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
+    std::uint8_t*       dstPixels = m_pixels.get() + (dest.x + dest.y * m_size.x) * 4;
 
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
+        // Interpolation using alpha values, row by row (slower)
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
-
+            priv::blendPixels(srcPixels, dstPixels, dstSize.x);
             srcPixels += srcStride;
             dstPixels += dstStride;
         }
@@ -529,7 +670,7 @@ void Image::setPixel(Vector2u coords, Color color)
     assert(coords.y < m_size.y && "Image::setPixel() y coordinate is out of bounds");
 
     const auto    index = (coords.x + coords.y * m_size.x) * 4;
-    std::uint8_t* pixel = &m_pixels[index];
+    std::uint8_t* pixel = m_pixels.get() + index;
     *pixel++            = color.r;
     *pixel++            = color.g;
     *pixel++            = color.b;
@@ -544,7 +685,7 @@ Color Image::getPixel(Vector2u coords) const
     assert(coords.y < m_size.y && "Image::getPixel() y coordinate is out of bounds");
 
     const auto          index = (coords.x + coords.y * m_size.x) * 4;
-    const std::uint8_t* pixel = &m_pixels[index];
+    const std::uint8_t* pixel = m_pixels.get() + index;
     return {pixel[0], pixel[1], pixel[2], pixel[3]};
 }
 
@@ -552,9 +693,9 @@ Color Image::getPixel(Vector2u coords) const
 ////////////////////////////////////////////////////////////
 const std::uint8_t* Image::getPixelsPtr() const
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
-        return m_pixels.data();
+        return m_pixels.get();
     }
 
     err() << "Trying to access the pixels of an empty image" << std::endl;
@@ -565,24 +706,12 @@ const std::uint8_t* Image::getPixelsPtr() const
 ////////////////////////////////////////////////////////////
 void Image::flipHorizontally()
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
         const std::size_t rowSize = m_size.x * 4;
 
         for (std::size_t y = 0; y < m_size.y; ++y)
-        {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
-
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
-
-                left += 4;
-                right -= 4;
-            }
-        }
+            priv::reversePixels(m_pixels.get() + y * rowSize, m_size.x);
     }
 }
 
@@ -590,12 +719,12 @@ void Image::flipHorizontally()
 ////////////////////////////////////////////////////////////
 void Image::flipVertically()
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
-        const auto rowSize = static_cast<std::vector<std::uint8_t>::iterator::difference_type>(m_size.x * 4);
+        const std::size_t rowSize = std::size_t{m_size.x} * 4;
 
-        auto top    = m_pixels.begin();
-        auto bottom = m_pixels.end() - rowSize;
+        std::uint8_t* top    = m_pixels.get();
+        std::uint8_t* bottom = top + (m_size.y - 1) * rowSize;
 
         for (std::size_t y = 0; y < m_size.y / 2; ++y)
         {
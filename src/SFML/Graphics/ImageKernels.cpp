@@ -0,0 +1,530 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageKernels.hpp>
+
+#include <algorithm>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_IMAGE_KERNELS_SSE2
+#define SFML_IMAGE_KERNELS_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// The channels are extracted with shifts, which assumes little-endian pixels
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(__ARM_BIG_ENDIAN)
+#define SFML_IMAGE_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+// AVX2 functions are compiled on demand with GCC and Clang, MSVC accepts the intrinsics as they are
+#if defined(__GNUC__) || defined(__clang__)
+#define SFML_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SFML_TARGET_AVX2
+#endif
+
+
+namespace
+{
+// Pack four channels into a pixel, in memory order
+std::uint32_t toPixel(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+{
+    const std::uint8_t bytes[] = {r, g, b, a};
+    std::uint32_t      pixel   = 0;
+    std::memcpy(&pixel, bytes, sizeof(pixel));
+    return pixel;
+}
+
+
+////////////////////////////////////////////////////////////
+// Scalar implementations, also used for the pixels that don't fill a whole vector
+////////////////////////////////////////////////////////////
+void maskFromColorScalar(std::uint8_t* pixels, std::size_t pixelCount, sf::Color color, std::uint8_t alpha)
+{
+    std::uint8_t* ptr = pixels;
+    std::uint8_t* end = ptr + pixelCount * 4;
+    while (ptr < end)
+    {
+        if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
+            ptr[3] = alpha;
+        ptr += 4;
+    }
+}
+
+void blendPixelsScalar(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i)
+    {
+        // Get a direct pointer to the components of the current pixel
+        const std::uint8_t* src = source + i * 4;
+        std::uint8_t*       dst = destination + i * 4;
+
+        // Interpolate RGBA components using the alpha values of the destination and source pixels
+        const std::uint8_t srcAlpha = src[3];
+        const std::uint8_t dstAlpha = dst[3];
+        const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+        dst[3] = outAlpha;
+
+        if (outAlpha)
+            for (int k = 0; k < 3; k++)
+                dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+        else
+            for (int k = 0; k < 3; k++)
+                dst[k] = src[k];
+    }
+}
+
+void reversePixelsScalar(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + pixelCount * 4;
+    for (std::size_t x = 0; x < pixelCount / 2; ++x)
+    {
+        right -= 4;
+        std::swap_ranges(left, left + 4, right);
+        left += 4;
+    }
+}
+
+
+// The vector implementations of blendPixels compute in single precision floats:
+// every intermediate value is an integer below 2^24, so products and sums are exact,
+// and a truncated quotient always equals the integer division (two integer quotients
+// with a divisor up to 255 are too far apart for the float rounding to cross one)
+
+#ifdef SFML_IMAGE_KERNELS_SSE2
+
+////////////////////////////////////////////////////////////
+// SSE2 implementations, 4 pixels at a time
+////////////////////////////////////////////////////////////
+void maskFromColorSse2(std::uint8_t* pixels, std::size_t pixelCount, sf::Color color, std::uint8_t alpha)
+{
+    const __m128i key       = _mm_set1_epi32(static_cast<int>(toPixel(color.r, color.g, color.b, color.a)));
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(toPixel(0, 0, 0, 0xFF)));
+    const __m128i newAlpha  = _mm_set1_epi32(static_cast<int>(toPixel(0, 0, 0, alpha)));
+
+    std::size_t i = 0;
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto* const   ptr   = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i pixel = _mm_loadu_si128(ptr);
+        const __m128i match = _mm_and_si128(_mm_cmpeq_epi32(pixel, key), alphaMask);
+        _mm_storeu_si128(ptr, _mm_or_si128(_mm_andnot_si128(match, pixel), _mm_and_si128(match, newAlpha)));
+    }
+
+    maskFromColorScalar(pixels + i * 4, pixelCount - i, color, alpha);
+}
+
+__m128i blendChannelSse2(__m128i srcChannel, __m128i dstChannel, __m128 srcAlpha, __m128 dstWeight, __m128 outAlpha)
+{
+    const __m128  src     = _mm_cvtepi32_ps(srcChannel);
+    const __m128  dst     = _mm_cvtepi32_ps(dstChannel);
+    const __m128  divisor = _mm_max_ps(outAlpha, _mm_set1_ps(1.f));
+    const __m128i blended = _mm_cvttps_epi32(
+        _mm_div_ps(_mm_add_ps(_mm_mul_ps(src, srcAlpha), _mm_mul_ps(dst, dstWeight)), divisor));
+
+    // Pixels with a null output alpha take the source color
+    const __m128i transparent = _mm_castps_si128(_mm_cmpeq_ps(outAlpha, _mm_setzero_ps()));
+    return _mm_or_si128(_mm_and_si128(transparent, srcChannel), _mm_andnot_si128(transparent, blended));
+}
+
+void blendPixelsSse2(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount)
+{
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    const __m128  maxAlpha = _mm_set1_ps(255.f);
+
+    std::size_t i = 0;
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto* const   dstPtr = reinterpret_cast<__m128i*>(destination + i * 4);
+        const __m128i src    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+        const __m128i dst    = _mm_loadu_si128(dstPtr);
+
+        // outAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255
+        const __m128 srcAlpha  = _mm_cvtepi32_ps(_mm_srli_epi32(src, 24));
+        const __m128 dstAlpha  = _mm_cvtepi32_ps(_mm_srli_epi32(dst, 24));
+        const __m128 product   = _mm_cvtepi32_ps(
+            _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(srcAlpha, dstAlpha), maxAlpha)));
+        const __m128 outAlpha  = _mm_sub_ps(_mm_add_ps(srcAlpha, dstAlpha), product);
+        const __m128 dstWeight = _mm_sub_ps(outAlpha, srcAlpha);
+
+        const __m128i r = blendChannelSse2(_mm_and_si128(src, byteMask),
+                                           _mm_and_si128(dst, byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m128i g = blendChannelSse2(_mm_and_si128(_mm_srli_epi32(src, 8), byteMask),
+                                           _mm_and_si128(_mm_srli_epi32(dst, 8), byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m128i b = blendChannelSse2(_mm_and_si128(_mm_srli_epi32(src, 16), byteMask),
+                                           _mm_and_si128(_mm_srli_epi32(dst, 16), byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m128i a = _mm_cvttps_epi32(outAlpha);
+
+        _mm_storeu_si128(dstPtr,
+                         _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                      _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24))));
+    }
+
+    blendPixelsScalar(source + i * 4, destination + i * 4, pixelCount - i);
+}
+
+void reversePixelsSse2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    // Swap blocks of 4 pixels from both ends, the middle is left to the scalar version
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + pixelCount * 4;
+    while (right - left >= 32)
+    {
+        right -= 16;
+        const __m128i leftPixels  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+        const __m128i rightPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(left), _mm_shuffle_epi32(rightPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(right), _mm_shuffle_epi32(leftPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+        left += 16;
+    }
+
+    reversePixelsScalar(left, static_cast<std::size_t>(right - left) / 4);
+}
+
+#endif // SFML_IMAGE_KERNELS_SSE2
+
+#ifdef SFML_IMAGE_KERNELS_AVX2
+
+////////////////////////////////////////////////////////////
+// AVX2 implementations, 8 pixels at a time
+////////////////////////////////////////////////////////////
+SFML_TARGET_AVX2 void maskFromColorAvx2(std::uint8_t* pixels,
+                                        std::size_t   pixelCount,
+                                        sf::Color     color,
+                                        std::uint8_t  alpha)
+{
+    const __m256i key       = _mm256_set1_epi32(static_cast<int>(toPixel(color.r, color.g, color.b, color.a)));
+    const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(toPixel(0, 0, 0, 0xFF)));
+    const __m256i newAlpha  = _mm256_set1_epi32(static_cast<int>(toPixel(0, 0, 0, alpha)));
+
+    std::size_t i = 0;
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto* const   ptr   = reinterpret_cast<__m256i*>(pixels + i * 4);
+        const __m256i pixel = _mm256_loadu_si256(ptr);
+        const __m256i match = _mm256_and_si256(_mm256_cmpeq_epi32(pixel, key), alphaMask);
+        _mm256_storeu_si256(ptr, _mm256_blendv_epi8(pixel, newAlpha, match));
+    }
+
+    maskFromColorSse2(pixels + i * 4, pixelCount - i, color, alpha);
+}
+
+SFML_TARGET_AVX2 __m256i
+    blendChannelAvx2(__m256i srcChannel, __m256i dstChannel, __m256 srcAlpha, __m256 dstWeight, __m256 outAlpha)
+{
+    const __m256  src     = _mm256_cvtepi32_ps(srcChannel);
+    const __m256  dst     = _mm256_cvtepi32_ps(dstChannel);
+    const __m256  divisor = _mm256_max_ps(outAlpha, _mm256_set1_ps(1.f));
+    const __m256i blended = _mm256_cvttps_epi32(
+        _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(src, srcAlpha), _mm256_mul_ps(dst, dstWeight)), divisor));
+
+    // Pixels with a null output alpha take the source color
+    const __m256i transparent = _mm256_castps_si256(_mm256_cmp_ps(outAlpha, _mm256_setzero_ps(), _CMP_EQ_OQ));
+    return _mm256_blendv_epi8(blended, srcChannel, transparent);
+}
+
+SFML_TARGET_AVX2 void blendPixelsAvx2(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount)
+{
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    const __m256  maxAlpha = _mm256_set1_ps(255.f);
+
+    std::size_t i = 0;
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto* const   dstPtr = reinterpret_cast<__m256i*>(destination + i * 4);
+        const __m256i src    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * 4));
+        const __m256i dst    = _mm256_loadu_si256(dstPtr);
+
+        // outAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255
+        const __m256 srcAlpha  = _mm256_cvtepi32_ps(_mm256_srli_epi32(src, 24));
+        const __m256 dstAlpha  = _mm256_cvtepi32_ps(_mm256_srli_epi32(dst, 24));
+        const __m256 product   = _mm256_cvtepi32_ps(
+            _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(srcAlpha, dstAlpha), maxAlpha)));
+        const __m256 outAlpha  = _mm256_sub_ps(_mm256_add_ps(srcAlpha, dstAlpha), product);
+        const __m256 dstWeight = _mm256_sub_ps(outAlpha, srcAlpha);
+
+        const __m256i r = blendChannelAvx2(_mm256_and_si256(src, byteMask),
+                                           _mm256_and_si256(dst, byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m256i g = blendChannelAvx2(_mm256_and_si256(_mm256_srli_epi32(src, 8), byteMask),
+                                           _mm256_and_si256(_mm256_srli_epi32(dst, 8), byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m256i b = blendChannelAvx2(_mm256_and_si256(_mm256_srli_epi32(src, 16), byteMask),
+                                           _mm256_and_si256(_mm256_srli_epi32(dst, 16), byteMask),
+                                           srcAlpha,
+                                           dstWeight,
+                                           outAlpha);
+        const __m256i a = _mm256_cvttps_epi32(outAlpha);
+
+        _mm256_storeu_si256(dstPtr,
+                            _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                                            _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(a, 24))));
+    }
+
+    blendPixelsSse2(source + i * 4, destination + i * 4, pixelCount - i);
+}
+
+SFML_TARGET_AVX2 void reversePixelsAvx2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    // Swap blocks of 8 pixels from both ends, the middle is left to the SSE2 version
+    const __m256i reversed = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + pixelCount * 4;
+    while (right - left >= 64)
+    {
+        right -= 32;
+        const __m256i leftPixels  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left));
+        const __m256i rightPixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(left), _mm256_permutevar8x32_epi32(rightPixels, reversed));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(right), _mm256_permutevar8x32_epi32(leftPixels, reversed));
+        left += 32;
+    }
+
+    reversePixelsSse2(left, static_cast<std::size_t>(right - left) / 4);
+}
+
+bool hasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    // The OS must save the YMM registers (OSXSAVE, then XCR0 bits 1 and 2)
+    __cpuid(info, 1);
+    if (((info[2] & (1 << 27)) == 0) || ((_xgetbv(0) & 0x6) != 0x6))
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    // Required before __builtin_cpu_supports when called before the constructors of the library have run
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // SFML_IMAGE_KERNELS_AVX2
+
+#ifdef SFML_IMAGE_KERNELS_NEON
+
+////////////////////////////////////////////////////////////
+// NEON implementations, 4 pixels at a time
+////////////////////////////////////////////////////////////
+void maskFromColorNeon(std::uint8_t* pixels, std::size_t pixelCount, sf::Color color, std::uint8_t alpha)
+{
+    const uint32x4_t key       = vdupq_n_u32(toPixel(color.r, color.g, color.b, color.a));
+    const uint32x4_t alphaMask = vdupq_n_u32(toPixel(0, 0, 0, 0xFF));
+    const uint32x4_t newAlpha  = vdupq_n_u32(toPixel(0, 0, 0, alpha));
+
+    std::size_t i = 0;
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto* const      ptr   = reinterpret_cast<std::uint32_t*>(pixels + i * 4);
+        const uint32x4_t pixel = vld1q_u32(ptr);
+        const uint32x4_t match = vandq_u32(vceqq_u32(pixel, key), alphaMask);
+        vst1q_u32(ptr, vbslq_u32(match, newAlpha, pixel));
+    }
+
+    maskFromColorScalar(pixels + i * 4, pixelCount - i, color, alpha);
+}
+
+uint32x4_t blendChannelNeon(uint32x4_t  srcChannel,
+                            uint32x4_t  dstChannel,
+                            float32x4_t srcAlpha,
+                            float32x4_t dstWeight,
+                            float32x4_t outAlpha)
+{
+    const float32x4_t src     = vcvtq_f32_u32(srcChannel);
+    const float32x4_t dst     = vcvtq_f32_u32(dstChannel);
+    const float32x4_t divisor = vmaxq_f32(outAlpha, vdupq_n_f32(1.f));
+    const uint32x4_t  blended = vcvtq_u32_f32(
+        vdivq_f32(vaddq_f32(vmulq_f32(src, srcAlpha), vmulq_f32(dst, dstWeight)), divisor));
+
+    // Pixels with a null output alpha take the source color
+    return vbslq_u32(vceqq_f32(outAlpha, vdupq_n_f32(0.f)), srcChannel, blended);
+}
+
+void blendPixelsNeon(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount)
+{
+    const uint32x4_t  byteMask = vdupq_n_u32(0xFF);
+    const float32x4_t maxAlpha = vdupq_n_f32(255.f);
+
+    std::size_t i = 0;
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto* const      dstPtr = reinterpret_cast<std::uint32_t*>(destination + i * 4);
+        const uint32x4_t src    = vld1q_u32(reinterpret_cast<const std::uint32_t*>(source + i * 4));
+        const uint32x4_t dst    = vld1q_u32(dstPtr);
+
+        // outAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255
+        const float32x4_t srcAlpha  = vcvtq_f32_u32(vshrq_n_u32(src, 24));
+        const float32x4_t dstAlpha  = vcvtq_f32_u32(vshrq_n_u32(dst, 24));
+        const float32x4_t product   = vcvtq_f32_u32(vcvtq_u32_f32(vdivq_f32(vmulq_f32(srcAlpha, dstAlpha), maxAlpha)));
+        const float32x4_t outAlpha  = vsubq_f32(vaddq_f32(srcAlpha, dstAlpha), product);
+        const float32x4_t dstWeight = vsubq_f32(outAlpha, srcAlpha);
+
+        const uint32x4_t r = blendChannelNeon(vandq_u32(src, byteMask),
+                                              vandq_u32(dst, byteMask),
+                                              srcAlpha,
+                                              dstWeight,
+                                              outAlpha);
+        const uint32x4_t g = blendChannelNeon(vandq_u32(vshrq_n_u32(src, 8), byteMask),
+                                              vandq_u32(vshrq_n_u32(dst, 8), byteMask),
+                                              srcAlpha,
+                                              dstWeight,
+                                              outAlpha);
+        const uint32x4_t b = blendChannelNeon(vandq_u32(vshrq_n_u32(src, 16), byteMask),
+                                              vandq_u32(vshrq_n_u32(dst, 16), byteMask),
+                                              srcAlpha,
+                                              dstWeight,
+                                              outAlpha);
+        const uint32x4_t a = vcvtq_u32_f32(outAlpha);
+
+        vst1q_u32(dstPtr,
+                  vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)), vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24))));
+    }
+
+    blendPixelsScalar(source + i * 4, destination + i * 4, pixelCount - i);
+}
+
+void reversePixelsNeon(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    // Reverse the 4 lanes of a vector: swap within each half, then swap the halves
+    const auto reverse = [](uint32x4_t vector)
+    {
+        const uint32x4_t swapped = vrev64q_u32(vector);
+        return vextq_u32(swapped, swapped, 2);
+    };
+
+    // Swap blocks of 4 pixels from both ends, the middle is left to the scalar version
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + pixelCount * 4;
+    while (right - left >= 32)
+    {
+        right -= 16;
+        const uint32x4_t leftPixels  = vld1q_u32(reinterpret_cast<const std::uint32_t*>(left));
+        const uint32x4_t rightPixels = vld1q_u32(reinterpret_cast<const std::uint32_t*>(right));
+        vst1q_u32(reinterpret_cast<std::uint32_t*>(left), reverse(rightPixels));
+        vst1q_u32(reinterpret_cast<std::uint32_t*>(right), reverse(leftPixels));
+        left += 16;
+    }
+
+    reversePixelsScalar(left, static_cast<std::size_t>(right - left) / 4);
+}
+
+#endif // SFML_IMAGE_KERNELS_NEON
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+const std::vector<ImageKernels>& getImageKernels()
+{
+    // List the implementations supported by the CPU, once
+    static const std::vector<ImageKernels> kernels = []
+    {
+        std::vector<ImageKernels> result{{"Scalar", maskFromColorScalar, blendPixelsScalar, reversePixelsScalar}};
+
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+        result.push_back({"SSE2", maskFromColorSse2, blendPixelsSse2, reversePixelsSse2});
+#endif
+
+#if defined(SFML_IMAGE_KERNELS_AVX2)
+        if (hasAvx2())
+            result.push_back({"AVX2", maskFromColorAvx2, blendPixelsAvx2, reversePixelsAvx2});
+#endif
+
+#if defined(SFML_IMAGE_KERNELS_NEON)
+        result.push_back({"NEON", maskFromColorNeon, blendPixelsNeon, reversePixelsNeon});
+#endif
+
+        return result;
+    }();
+
+    return kernels;
+}
+
+
+////////////////////////////////////////////////////////////
+void maskFromColor(std::uint8_t* pixels, std::size_t pixelCount, Color color, std::uint8_t alpha)
+{
+    getImageKernels().back().maskFromColor(pixels, pixelCount, color, alpha);
+}
+
+
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount)
+{
+    // Rows that partially overlap must be processed pixel by pixel, in order, for
+    // the results to match (a vector implementation loads pixels before storing)
+    const auto sourceAddress      = reinterpret_cast<std::uintptr_t>(source);
+    const auto destinationAddress = reinterpret_cast<std::uintptr_t>(destination);
+    const auto byteCount          = pixelCount * 4;
+    if ((sourceAddress != destinationAddress) && (sourceAddress < destinationAddress + byteCount) &&
+        (destinationAddress < sourceAddress + byteCount))
+    {
+        blendPixelsScalar(source, destination, pixelCount);
+        return;
+    }
+
+    getImageKernels().back().blendPixels(source, destination, pixelCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    getImageKernels().back().reversePixels(pixels, pixelCount);
+}
+
+} // namespace sf::priv
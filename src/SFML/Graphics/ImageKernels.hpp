@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of the image kernels for an instruction set
+///
+////////////////////////////////////////////////////////////
+struct ImageKernels
+{
+    using MaskFromColor = void (*)(std::uint8_t*, std::size_t, Color, std::uint8_t);
+    using BlendPixels   = void (*)(const std::uint8_t*, std::uint8_t*, std::size_t);
+    using ReversePixels = void (*)(std::uint8_t*, std::size_t);
+
+    const char*   name;          //!< Name of the instruction set
+    MaskFromColor maskFromColor; //!< Implementation of `maskFromColor`
+    BlendPixels   blendPixels;   //!< Implementation of `blendPixels`
+    ReversePixels reversePixels; //!< Implementation of `reversePixels`
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the implementations of the image kernels that can run on this CPU
+///
+/// The first one is the scalar implementation, which all the
+/// others must match; the last one is used by the functions
+/// below. The tests compare every implementation compiled in
+/// the library and supported by the CPU with the scalar one.
+///
+/// \return Implementations that can be used, the best one last
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API const std::vector<ImageKernels>& getImageKernels();
+
+////////////////////////////////////////////////////////////
+/// \brief Replace the alpha of the pixels that match a color
+///
+/// The implementation is chosen at runtime according to the
+/// instruction sets supported by the CPU (AVX2, SSE2, NEON),
+/// all of them produce the same results.
+///
+/// \param pixels     Array of RGBA pixels to modify
+/// \param pixelCount Number of pixels in the array
+/// \param color      Color to make transparent
+/// \param alpha      Alpha value to assign to the matching pixels
+///
+////////////////////////////////////////////////////////////
+void maskFromColor(std::uint8_t* pixels, std::size_t pixelCount, Color color, std::uint8_t alpha);
+
+////////////////////////////////////////////////////////////
+/// \brief Blend a row of pixels over another one, using their alpha values
+///
+/// \param source      Array of RGBA pixels to blend
+/// \param destination Array of RGBA pixels to blend into
+/// \param pixelCount  Number of pixels in each array
+///
+/// \see `maskFromColor`
+///
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t pixelCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Reverse the order of a row of pixels
+///
+/// \param pixels     Array of RGBA pixels to reverse
+/// \param pixelCount Number of pixels in the array
+///
+/// \see `maskFromColor`
+///
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t pixelCount);
+
+} // namespace sf::priv
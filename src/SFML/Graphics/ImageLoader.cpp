@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageLoader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/ThreadPool.hpp>
+
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageLoader::Impl
+{
+    explicit Impl(unsigned int threadCount) : pool(threadCount)
+    {
+    }
+
+    struct Upload
+    {
+        Image                 image;   //!< Decoded image, waiting to become a texture
+        bool                  sRgb{};  //!< Should the texture source be converted from sRGB?
+        std::promise<Texture> promise; //!< Receives the texture
+    };
+
+    std::mutex         mutex;   //!< Protects the upload queue
+    std::deque<Upload> uploads; //!< Images waiting to be uploaded to a texture
+    priv::ThreadPool   pool;    //!< Decoding threads, destroyed first so that the queued images finish decoding
+};
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(unsigned int threadCount) : m_impl(std::make_unique<Impl>(threadCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::~ImageLoader() = default;
+
+
+////////////////////////////////////////////////////////////
+unsigned int ImageLoader::getThreadCount() const
+{
+    return m_impl->pool.getThreadCount();
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<Image> ImageLoader::loadFromFile(const std::filesystem::path& filename)
+{
+    std::packaged_task<Image()> task([filename] { return Image(filename); });
+    std::future<Image>          future = task.get_future();
+    m_impl->pool.enqueue(std::packaged_task<void()>(std::move(task)));
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageLoader::loadFromFile(const std::filesystem::path& filename, Callback callback)
+{
+    m_impl->pool.enqueue(std::packaged_task<void()>(
+        [filename, callback = std::move(callback)]
+        {
+            Image image;
+            if (image.loadFromFile(filename))
+                callback(std::move(image));
+            else
+                callback(std::nullopt);
+        }));
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::future<Image>> ImageLoader::loadFromFiles(const std::vector<std::filesystem::path>& filenames)
+{
+    std::vector<std::future<Image>> futures;
+    futures.reserve(filenames.size());
+    for (const std::filesystem::path& filename : filenames)
+        futures.push_back(loadFromFile(filename));
+
+    return futures;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<Image> ImageLoader::loadFromStream(InputStream& stream)
+{
+    std::packaged_task<Image()> task([&stream] { return Image(stream); });
+    std::future<Image>          future = task.get_future();
+    m_impl->pool.enqueue(std::packaged_task<void()>(std::move(task)));
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<Texture> ImageLoader::loadTextureFromFile(const std::filesystem::path& filename, bool sRgb)
+{
+    std::promise<Texture> promise;
+    std::future<Texture>  future = promise.get_future();
+
+    m_impl->pool.enqueue(std::packaged_task<void()>(
+        [impl = m_impl.get(), filename, sRgb, promise = std::move(promise)]() mutable
+        {
+            Image image;
+            if (!image.loadFromFile(filename))
+            {
+                promise.set_exception(std::make_exception_ptr(Exception("Failed to load texture from file")));
+                return;
+            }
+
+            // The texture must be created by the thread that owns the OpenGL context
+            const std::lock_guard lock(impl->mutex);
+            impl->uploads.push_back({std::move(image), sRgb, std::move(promise)});
+        }));
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageLoader::uploadTextures(std::size_t maxCount)
+{
+    std::size_t count = 0;
+    while (count < maxCount)
+    {
+        Impl::Upload upload;
+
+        {
+            const std::lock_guard lock(m_impl->mutex);
+            if (m_impl->uploads.empty())
+                break;
+
+            upload = std::move(m_impl->uploads.front());
+            m_impl->uploads.pop_front();
+        }
+
+        try
+        {
+            upload.promise.set_value(Texture(upload.image, upload.sRgb));
+        }
+        catch (...)
+        {
+            upload.promise.set_exception(std::current_exception());
+        }
+
+        ++count;
+    }
+
+    return count;
+}
+
+} // namespace sf
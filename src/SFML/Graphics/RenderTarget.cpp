@@ -199,6 +199,9 @@ namespace sf
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Pending draws must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -217,6 +220,9 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    // Pending draws must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -235,6 +241,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    // Pending draws must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -254,6 +263,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending draws were transformed for the previous view
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -351,6 +363,128 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
+    // Collect the primitives into the pending batch if possible
+    if (m_batchingEnabled && appendToBatch(vertices, vertexCount, type, states))
+        return;
+
+    flush();
+    drawImmediate(vertices, vertexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
+
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle())
+        return;
+
+    flush();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batchingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batchingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    // Nothing to draw?
+    if (m_batch.vertices.empty())
+        return;
+
+    // Detach the vertices before drawing them, since resetting
+    // the GL states during the draw would flush them again
+    std::vector<Vertex> vertices;
+    vertices.swap(m_batch.vertices);
+
+    drawImmediate(vertices.data(), vertices.size(), m_batch.type, m_batch.states);
+
+    // Give the storage back to the batch so that it can be reused
+    vertices.clear();
+    m_batch.vertices.swap(vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::DrawStatistics& RenderTarget::getDrawStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetDrawStatistics()
+{
+    m_statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawImmediate(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
@@ -414,59 +548,100 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
-{
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
-}
-
-
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+bool RenderTarget::appendToBatch(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
 {
-    // VertexBuffer not supported?
-    if (!VertexBuffer::isAvailable())
+    // Shader parameters and render texture contents can change before
+    // the batch is flushed, so draws that use them are never batched
+    if (states.shader || (states.texture && states.texture->m_fboAttachment))
+        return false;
+
+    // Strips and fans are converted to independent triangles so that they can be concatenated,
+    // incomplete primitives are dropped since OpenGL would not render them either
+    PrimitiveType batchType{};
+    std::size_t   batchVertexCount = 0;
+    switch (type)
     {
-        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
-        return;
+        case PrimitiveType::Points:
+            batchType        = PrimitiveType::Points;
+            batchVertexCount = vertexCount;
+            break;
+        case PrimitiveType::Lines:
+            batchType        = PrimitiveType::Lines;
+            batchVertexCount = vertexCount - vertexCount % 2;
+            break;
+        case PrimitiveType::Triangles:
+            batchType        = PrimitiveType::Triangles;
+            batchVertexCount = vertexCount - vertexCount % 3;
+            break;
+        case PrimitiveType::TriangleStrip:
+        case PrimitiveType::TriangleFan:
+            batchType        = PrimitiveType::Triangles;
+            batchVertexCount = (vertexCount >= 3) ? (vertexCount - 2) * 3 : 0;
+            break;
+        case PrimitiveType::LineStrip:
+            return false;
     }
 
-    // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
-        return;
-
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+    if (batchVertexCount == 0)
+        return true;
 
-    // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
-        return;
-
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    // Flush the pending batch if it cannot be extended with these primitives
+    const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
+    if (!m_batch.vertices.empty())
     {
-        setupDraw(false, states);
-
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
-
-        // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
-
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        if ((batchType == m_batch.type) && (states.texture == m_batch.states.texture) &&
+            (textureId == m_batch.textureId) && (states.coordinateType == m_batch.states.coordinateType) &&
+            (states.blendMode == m_batch.states.blendMode) && (states.stencilMode == m_batch.states.stencilMode))
+        {
+            ++m_statistics.mergedDraws;
+        }
+        else
+        {
+            flush();
+        }
+    }
 
-        // Unbind vertex buffer
-        VertexBuffer::bind(nullptr);
+    if (m_batch.vertices.empty())
+    {
+        m_batch.type      = batchType;
+        m_batch.states    = RenderStates(states.blendMode,
+                                         states.stencilMode,
+                                         Transform::Identity,
+                                         states.coordinateType,
+                                         states.texture,
+                                         nullptr);
+        m_batch.textureId = textureId;
+    }
 
-        cleanupDraw(states);
+    // Pre-transform the vertices, the batch is rendered with an identity transform
+    const auto append = [this, &states](const Vertex& vertex)
+    { m_batch.vertices.push_back({states.transform * vertex.position, vertex.color, vertex.texCoords}); };
 
-        // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
+    switch (type)
+    {
+        case PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[i - 2]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(vertices[0]);
+                append(vertices[i - 1]);
+                append(vertices[i]);
+            }
+            break;
+        default:
+            for (std::size_t i = 0; i < batchVertexCount; ++i)
+                append(vertices[i]);
+            break;
     }
+
+    return true;
 }
 
 
@@ -521,6 +696,9 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    // Pending draws must be rendered before the user takes over the GL states
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -552,6 +730,9 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
+    // Pending draws must be rendered before the user's GL states are restored
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         glCheck(glMatrixMode(GL_PROJECTION));
@@ -571,6 +752,9 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    // Pending draws must be rendered with the states they were issued with
+    flush();
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -647,6 +831,9 @@ void RenderTarget::initialize()
     // Set GL states only on first draw, so that we don't pollute user's states
     m_cache.glStatesSet = false;
 
+    // Draws pending from before the (re)creation of the target are discarded
+    m_batch.vertices.clear();
+
     // Generate a unique ID for this RenderTarget to track
     // whether it is active within a specific context
     m_id = RenderTargetImpl::getUniqueId();
@@ -894,6 +1081,7 @@ void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, s
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+    ++m_statistics.drawCalls;
 }
 
 
@@ -935,6 +1123,9 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   To avoid that, when the vertex count is low enough, we
 //   pre-transform them and therefore use an identity transform
 //   to render them.
+//   When batching is enabled, all the batched vertices are
+//   pre-transformed, which also allows consecutive draws with
+//   different transforms to share a single draw call.
 //
 // * Blending mode
 //   Since it overloads the == operator, we can easily check
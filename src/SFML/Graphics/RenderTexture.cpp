@@ -169,6 +169,9 @@ void RenderTexture::display()
     if (!m_impl)
         return;
 
+    // Render the pending draws before the texture is updated
+    flush();
+
     if (priv::RenderTextureImplFBO::isAvailable())
     {
         // Perform a RenderTarget-only activation if we are using FBOs
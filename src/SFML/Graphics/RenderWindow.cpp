@@ -103,6 +103,16 @@ bool RenderWindow::setActive(bool active)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderWindow::display()
+{
+    // Render the pending draws before the frame is presented
+    flush();
+
+    Window::display();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderWindow::onCreate()
 {
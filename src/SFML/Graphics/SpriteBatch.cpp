@@ -0,0 +1,370 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpriteBatchImpl
+{
+// Each sprite is made of two independent triangles so that sprites can be concatenated
+constexpr std::size_t verticesPerSprite = 6;
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(const Texture& texture) :
+m_texture(&texture),
+m_vertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Dynamic)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture() const
+{
+    return *m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(Vector2f position, const IntRect& textureRect, Color color)
+{
+    const std::size_t index = m_positions.size();
+
+    m_positions.push_back(position);
+    m_origins.emplace_back();
+    m_rotations.emplace_back();
+    m_scales.emplace_back(1.f, 1.f);
+    m_textureRects.push_back(textureRect);
+    m_colors.push_back(color);
+    m_dirty.push_back(false);
+    m_vertices.resize(m_vertices.size() + SpriteBatchImpl::verticesPerSprite);
+
+    invalidate(index);
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::remove(std::size_t index)
+{
+    assert(index < getSpriteCount() && "SpriteBatch::remove() Index is out of range");
+
+    // Move the last sprite into the removed slot
+    const std::size_t last = getSpriteCount() - 1;
+    if (index != last)
+    {
+        m_positions[index]    = m_positions[last];
+        m_origins[index]      = m_origins[last];
+        m_rotations[index]    = m_rotations[last];
+        m_scales[index]       = m_scales[last];
+        m_textureRects[index] = m_textureRects[last];
+        m_colors[index]       = m_colors[last];
+        invalidate(index);
+    }
+
+    m_positions.pop_back();
+    m_origins.pop_back();
+    m_rotations.pop_back();
+    m_scales.pop_back();
+    m_textureRects.pop_back();
+    m_colors.pop_back();
+    m_dirty.pop_back();
+    m_vertices.resize(m_vertices.size() - SpriteBatchImpl::verticesPerSprite);
+
+    // The outdated range must not extend past the remaining sprites
+    m_dirtyEnd = std::min(m_dirtyEnd, last);
+    if (m_dirtyBegin >= m_dirtyEnd)
+        m_dirtyBegin = m_dirtyEnd = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    m_positions.clear();
+    m_origins.clear();
+    m_rotations.clear();
+    m_scales.clear();
+    m_textureRects.clear();
+    m_colors.clear();
+    m_dirty.clear();
+    m_vertices.clear();
+    m_dirtyBegin = m_dirtyEnd = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t spriteCount)
+{
+    m_positions.reserve(spriteCount);
+    m_origins.reserve(spriteCount);
+    m_rotations.reserve(spriteCount);
+    m_scales.reserve(spriteCount);
+    m_textureRects.reserve(spriteCount);
+    m_colors.reserve(spriteCount);
+    m_dirty.reserve(spriteCount);
+    m_vertices.reserve(spriteCount * SpriteBatchImpl::verticesPerSprite);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getSpriteCount() const
+{
+    return m_positions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setPosition(std::size_t index, Vector2f position)
+{
+    m_positions[index] = position;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setOrigin(std::size_t index, Vector2f origin)
+{
+    m_origins[index] = origin;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setRotation(std::size_t index, Angle angle)
+{
+    m_rotations[index] = angle.wrapUnsigned();
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setScale(std::size_t index, Vector2f scale)
+{
+    m_scales[index] = scale;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTextureRect(std::size_t index, const IntRect& textureRect)
+{
+    m_textureRects[index] = textureRect;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setColor(std::size_t index, Color color)
+{
+    m_colors[index] = color;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getPosition(std::size_t index) const
+{
+    return m_positions[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getOrigin(std::size_t index) const
+{
+    return m_origins[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Angle SpriteBatch::getRotation(std::size_t index) const
+{
+    return m_rotations[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getScale(std::size_t index) const
+{
+    return m_scales[index];
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& SpriteBatch::getTextureRect(std::size_t index) const
+{
+    return m_textureRects[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Color SpriteBatch::getColor(std::size_t index) const
+{
+    return m_colors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_vertices.empty())
+        return;
+
+    ensureGeometryUpdate();
+
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    if (VertexBuffer::isAvailable())
+    {
+        bool upToDate = true;
+
+        if (m_vertexBuffer.getVertexCount() < m_vertices.size())
+        {
+            // Grow the buffer like the vertex array to avoid reallocating it for every added sprite
+            upToDate = m_vertexBuffer.create(m_vertices.capacity()) &&
+                       m_vertexBuffer.update(m_vertices.data(), m_vertices.size(), 0);
+        }
+        else if (m_dirtyBegin < m_dirtyEnd)
+        {
+            // Only upload the range of sprites that changed since the last draw
+            const std::size_t first = m_dirtyBegin * SpriteBatchImpl::verticesPerSprite;
+            const std::size_t count = (m_dirtyEnd - m_dirtyBegin) * SpriteBatchImpl::verticesPerSprite;
+            upToDate = m_vertexBuffer.update(m_vertices.data() + first, count, static_cast<unsigned int>(first));
+        }
+
+        m_dirtyBegin = m_dirtyEnd = 0;
+
+        if (upToDate)
+        {
+            target.draw(m_vertexBuffer, 0, m_vertices.size(), states);
+            return;
+        }
+
+        // Force a full upload on the next draw since the buffer is out of sync
+        m_vertexBuffer = VertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Dynamic);
+    }
+
+    m_dirtyBegin = m_dirtyEnd = 0;
+    target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::invalidate(std::size_t index)
+{
+    m_dirty[index] = true;
+
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = index;
+        m_dirtyEnd   = index + 1;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, index);
+        m_dirtyEnd   = std::max(m_dirtyEnd, index + 1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::ensureGeometryUpdate() const
+{
+    for (std::size_t i = m_dirtyBegin; i < m_dirtyEnd; ++i)
+    {
+        if (!m_dirty[i])
+            continue;
+
+        m_dirty[i] = false;
+
+        // Compute the transform of the sprite, like sf::Transformable does
+        const float    angle    = -m_rotations[i].asRadians();
+        const float    cosine   = std::cos(angle);
+        const float    sine     = std::sin(angle);
+        const Vector2f scale    = m_scales[i];
+        const Vector2f origin   = m_origins[i];
+        const Vector2f position = m_positions[i];
+        const float    sxc      = scale.x * cosine;
+        const float    syc      = scale.y * cosine;
+        const float    sxs      = scale.x * sine;
+        const float    sys      = scale.y * sine;
+        const float    tx       = -origin.x * sxc - origin.y * sys + position.x;
+        const float    ty       = origin.x * sxs - origin.y * syc + position.y;
+
+        // clang-format off
+        const Transform transform( sxc, sys, tx,
+                                  -sxs, syc, ty,
+                                   0.f, 0.f, 1.f);
+        // clang-format on
+
+        // Absolute value is used to support negative texture rect sizes
+        const auto [rectPosition, rectSize] = FloatRect(m_textureRects[i]);
+        const Vector2f absSize(std::abs(rectSize.x), std::abs(rectSize.y));
+
+        const Vertex corners[] = {
+            {transform.transformPoint({0.f, 0.f}), m_colors[i], rectPosition},
+            {transform.transformPoint({0.f, absSize.y}), m_colors[i], rectPosition + Vector2f(0.f, rectSize.y)},
+            {transform.transformPoint({absSize.x, 0.f}), m_colors[i], rectPosition + Vector2f(rectSize.x, 0.f)},
+            {transform.transformPoint(absSize), m_colors[i], rectPosition + rectSize},
+        };
+
+        Vertex* vertices = m_vertices.data() + i * SpriteBatchImpl::verticesPerSprite;
+        vertices[0]      = corners[0];
+        vertices[1]      = corners[1];
+        vertices[2]      = corners[2];
+        vertices[3]      = corners[2];
+        vertices[4]      = corners[1];
+        vertices[5]      = corners[3];
+    }
+}
+
+} // namespace sf
@@ -27,11 +27,14 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
+#include <vector>
 
 #include <cmath>
 #include <cstddef>
@@ -65,11 +68,17 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color co
 {
     const sf::Vector2f padding(1.f, 1.f);
 
+    // Glyphs of distance field fonts are scaled, so the padding must be scaled in the texture as well
+    const sf::Vector2f textureSize(glyph.textureRect.size);
+    const sf::Vector2f texturePadding = (glyph.bounds.size.x > 0) && (glyph.bounds.size.y > 0)
+                                            ? padding.componentWiseMul(textureSize.componentWiseDiv(glyph.bounds.size))
+                                            : padding;
+
     const sf::Vector2f p1 = glyph.bounds.position - padding;
     const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
 
-    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
-    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - texturePadding;
+    const auto uv2 = sf::Vector2f(glyph.textureRect.position) + textureSize + texturePadding;
 
     vertices.append({position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
@@ -78,6 +87,20 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color co
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
 }
+
+// Get the vertex array holding the glyphs of a given font texture
+sf::VertexArray& selectVertices(sf::VertexArray&              vertices,
+                                std::vector<sf::VertexArray>& spilledVertices,
+                                unsigned int                  textureIndex)
+{
+    if (textureIndex == 0)
+        return vertices;
+
+    if (spilledVertices.size() < textureIndex)
+        spilledVertices.resize(textureIndex, sf::VertexArray(sf::PrimitiveType::Triangles));
+
+    return spilledVertices[textureIndex - 1];
+}
 } // namespace
 
 
@@ -97,12 +120,43 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Only the characters following the common prefix need to be laid out again
+        const auto firstDifference = std::mismatch(m_string.begin(), m_string.end(), string.begin(), string.end()).first;
+        m_layoutStart = std::min(m_layoutStart, static_cast<std::size_t>(firstDifference - m_string.begin()));
+        m_string      = string;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::append(const String& string)
+{
+    insert(m_string.getSize(), string);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::insert(std::size_t position, const String& string)
+{
+    if (string.isEmpty())
+        return;
+
+    m_string.insert(position, string);
+    m_layoutStart = std::min(m_layoutStart, position);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::erase(std::size_t position, std::size_t count)
+{
+    if (count == 0)
+        return;
+
+    m_string.erase(position, count);
+    m_layoutStart = std::min(m_layoutStart, position);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setFont(const Font& font)
 {
@@ -171,6 +225,10 @@ void Text::setFillColor(Color color)
         {
             for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
                 m_vertices[i].color = m_fillColor;
+
+            for (VertexArray& vertices : m_spilledVertices)
+                for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+                    vertices[i].color = m_fillColor;
         }
     }
 }
@@ -189,6 +247,10 @@ void Text::setOutlineColor(Color color)
         {
             for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
                 m_outlineVertices[i].color = m_outlineColor;
+
+            for (VertexArray& vertices : m_spilledOutlineVertices)
+                for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+                    vertices[i].color = m_outlineColor;
         }
     }
 }
@@ -271,45 +333,14 @@ float Text::getOutlineThickness() const
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
+    // The positions are computed along with the geometry
+    ensureGeometryUpdate();
+
     // Adjust the index if it's out of range
     index = std::min(index, m_string.getSize());
 
-    // Precompute the variables needed by the algorithm
-    const bool  isBold          = m_style & Bold;
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
-    const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
-    whitespaceWidth += letterSpacing;
-    const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-
-    // Compute the position
-    Vector2f      position;
-    std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
-    {
-        const std::uint32_t curChar = m_string[i];
-
-        // Apply the kerning offset
-        position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
-        prevChar = curChar;
-
-        // Handle special characters
-        switch (curChar)
-        {
-            case U' ':
-                position.x += whitespaceWidth;
-                continue;
-            case U'\t':
-                position.x += whitespaceWidth * 4;
-                continue;
-            case U'\n':
-                position.y += lineSpacing;
-                position.x = 0;
-                continue;
-        }
-
-        // For regular characters, add the advance offset of the glyph
-        position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance + letterSpacing;
-    }
+    // Positions are recorded relative to the baseline of the first line
+    const Vector2f position = m_characterPositions[index] - Vector2f(0.f, static_cast<float>(m_characterSize));
 
     // Transform the position to global coordinates
     return getTransform().transformPoint(position);
@@ -341,35 +372,91 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Fonts in distance field mode draw their glyphs with their own shader, unless another one is provided.
+    // The shader is shared by all the texts using the font, so its threshold is set right before each draw
+    const bool distanceField = !states.shader && m_font->isDistanceFieldEnabled();
+    if (distanceField)
+        states.shader = m_font->getDistanceFieldShader();
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
+    {
+        if (distanceField)
+            m_font->m_distanceFieldShader->setUniform("threshold",
+                                                      m_font->getDistanceFieldThreshold(m_characterSize,
+                                                                                        m_outlineThickness));
+
         target.draw(m_outlineVertices, states);
 
+        // Glyphs that didn't fit in the first font texture are drawn with their own texture
+        for (std::size_t i = 0; i < m_spilledOutlineVertices.size(); ++i)
+        {
+            RenderStates spilledStates = states;
+            spilledStates.texture      = &m_font->getTexture(m_characterSize, i + 1);
+            target.draw(m_spilledOutlineVertices[i], spilledStates);
+        }
+    }
+
+    if (distanceField)
+        m_font->m_distanceFieldShader->setUniform("threshold", m_font->getDistanceFieldThreshold(m_characterSize));
+
     target.draw(m_vertices, states);
+
+    for (std::size_t i = 0; i < m_spilledVertices.size(); ++i)
+    {
+        RenderStates spilledStates = states;
+        spilledStates.texture      = &m_font->getTexture(m_characterSize, i + 1);
+        target.draw(m_spilledVertices[i], spilledStates);
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    // Check whether any of the font textures has changed
+    const std::size_t textureCount        = m_font->getTextureCount(m_characterSize);
+    bool              fontTexturesChanged = m_fontTextureIds.size() != textureCount;
+    for (std::size_t i = 0; (i < textureCount) && !fontTexturesChanged; ++i)
+        fontTexturesChanged = m_font->getTexture(m_characterSize, i).m_cacheId != m_fontTextureIds[i];
+
+    // Do nothing, if geometry has not changed and the font textures have not changed
+    const bool fullUpdate = m_geometryNeedUpdate || fontTexturesChanged;
+    if (!fullUpdate && (m_layoutStart == String::InvalidPos))
         return;
 
-    // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    // Save the current ids of the font textures
+    m_fontTextureIds.resize(textureCount);
+    for (std::size_t i = 0; i < textureCount; ++i)
+        m_fontTextureIds[i] = m_font->getTexture(m_characterSize, i).m_cacheId;
 
     // Mark geometry as updated
-    m_geometryNeedUpdate = false;
+    const std::size_t layoutStart = m_layoutStart;
+    m_geometryNeedUpdate          = false;
+    m_layoutStart                 = String::InvalidPos;
+
+    // After an edit of the string, the lines preceding the edit can be kept as they are
+    const bool partialUpdate = !fullUpdate && !m_lines.empty() && !m_string.isEmpty();
 
     // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
+    if (!partialUpdate)
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_spilledVertices.clear();
+        m_spilledOutlineVertices.clear();
+        m_lines.clear();
+        m_characterPositions.clear();
+    }
+
     m_bounds = FloatRect();
 
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_characterPositions.emplace_back(0.f, static_cast<float>(m_characterSize));
         return;
+    }
 
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
@@ -398,8 +485,62 @@ void Text::ensureGeometryUpdate() const
     float         maxX     = 0.f;
     float         maxY     = 0.f;
     std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+
+    // Record the layout state at the start of a line, so that the text can be laid out again from there
+    const auto beginLine = [&](std::size_t firstCharacter)
+    {
+        Line& line              = m_lines.emplace_back();
+        line.firstCharacter     = firstCharacter;
+        line.vertexCount        = m_vertices.getVertexCount();
+        line.outlineVertexCount = m_outlineVertices.getVertexCount();
+        line.y                  = y;
+        line.min                = {minX, minY};
+        line.max                = {maxX, maxY};
+
+        // The glyphs of the other font textures are in separate vertex arrays
+        for (const VertexArray& vertices : m_spilledVertices)
+            line.spilledVertexCounts.push_back(vertices.getVertexCount());
+        for (const VertexArray& vertices : m_spilledOutlineVertices)
+            line.spilledOutlineVertexCounts.push_back(vertices.getVertexCount());
+    };
+
+    // Resume from the start of the line containing the first edited character, if possible
+    if (partialUpdate)
     {
+        const auto line = std::prev(std::upper_bound(m_lines.begin(),
+                                                     m_lines.end(),
+                                                     layoutStart,
+                                                     [](std::size_t index, const Line& l)
+                                                     { return index < l.firstCharacter; }));
+
+        m_vertices.resize(line->vertexCount);
+        m_outlineVertices.resize(line->outlineVertexCount);
+        m_spilledVertices.resize(line->spilledVertexCounts.size(), VertexArray(PrimitiveType::Triangles));
+        for (std::size_t i = 0; i < m_spilledVertices.size(); ++i)
+            m_spilledVertices[i].resize(line->spilledVertexCounts[i]);
+        m_spilledOutlineVertices.resize(line->spilledOutlineVertexCounts.size(), VertexArray(PrimitiveType::Triangles));
+        for (std::size_t i = 0; i < m_spilledOutlineVertices.size(); ++i)
+            m_spilledOutlineVertices[i].resize(line->spilledOutlineVertexCounts[i]);
+        m_characterPositions.resize(line->firstCharacter);
+        y        = line->y;
+        minX     = line->min.x;
+        minY     = line->min.y;
+        maxX     = line->max.x;
+        maxY     = line->max.y;
+        prevChar = (line->firstCharacter > 0) ? U'\n' : 0;
+        m_lines.erase(std::next(line), m_lines.end());
+    }
+    else
+    {
+        beginLine(0);
+    }
+
+    m_characterPositions.reserve(m_string.getSize() + 1);
+    for (std::size_t i = m_characterPositions.size(); i < m_string.getSize(); ++i)
+    {
+        const std::uint32_t curChar = m_string[i];
+        m_characterPositions.emplace_back(x, y);
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
@@ -452,6 +593,9 @@ void Text::ensureGeometryUpdate() const
             maxX = std::max(maxX, x);
             maxY = std::max(maxY, y);
 
+            if (curChar == U'\n')
+                beginLine(i + 1);
+
             // Next glyph, no need to create a quad for whitespace
             continue;
         }
@@ -462,14 +606,22 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            addGlyphQuad(selectVertices(m_outlineVertices, m_spilledOutlineVertices, glyph.textureIndex),
+                         Vector2f(x, y),
+                         m_outlineColor,
+                         glyph,
+                         italicShear);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(selectVertices(m_vertices, m_spilledVertices, glyph.textureIndex),
+                     Vector2f(x, y),
+                     m_fillColor,
+                     glyph,
+                     italicShear);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
@@ -484,6 +636,8 @@ void Text::ensureGeometryUpdate() const
         x += glyph.advance + letterSpacing;
     }
 
+    m_characterPositions.emplace_back(x, y);
+
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
     {
@@ -29,6 +29,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -66,6 +67,35 @@ std::uint64_t getUniqueId() noexcept
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct Texture::UploadBuffers
+{
+    struct Slot
+    {
+        GLuint       buffer{};   //!< Pixel buffer object holding the pixels of one upload
+        GLEXT_GLsync fence{};    //!< Signaled once the upload from the buffer is complete
+        std::size_t  capacity{}; //!< Size of the buffer storage, in bytes
+    };
+
+    ~UploadBuffers()
+    {
+        const TransientContextLock lock;
+
+        for (Slot& slot : slots)
+        {
+            if (slot.fence)
+                glCheck(GLEXT_glDeleteSync(slot.fence));
+
+            if (slot.buffer)
+                glCheck(GLEXT_glDeleteBuffers(1, &slot.buffer));
+        }
+    }
+
+    std::array<Slot, 3> slots; //!< Used in turn, so that an upload rarely has to wait for the previous ones
+    std::size_t         next{}; //!< Index of the slot to use for the next upload
+};
+
+
 ////////////////////////////////////////////////////////////
 Texture::Texture() : m_cacheId(TextureImpl::getUniqueId())
 {
@@ -150,6 +180,7 @@ GlResource(copy),
 m_isSmooth(copy.m_isSmooth),
 m_sRgb(copy.m_sRgb),
 m_isRepeated(copy.m_isRepeated),
+m_flushOnUpdate(copy.m_flushOnUpdate),
 m_cacheId(TextureImpl::getUniqueId())
 {
     if (copy.m_texture)
@@ -197,7 +228,9 @@ m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_pixelsFlipped(std::exchange(right.m_pixelsFlipped, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
 m_hasMipmap(std::exchange(right.m_hasMipmap, false)),
-m_cacheId(std::exchange(right.m_cacheId, 0))
+m_flushOnUpdate(std::exchange(right.m_flushOnUpdate, false)),
+m_cacheId(std::exchange(right.m_cacheId, 0)),
+m_uploadBuffers(std::move(right.m_uploadBuffers))
 {
 }
 
@@ -229,7 +262,9 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_pixelsFlipped = std::exchange(right.m_pixelsFlipped, false);
     m_fboAttachment = std::exchange(right.m_fboAttachment, false);
     m_hasMipmap     = std::exchange(right.m_hasMipmap, false);
+    m_flushOnUpdate = std::exchange(right.m_flushOnUpdate, false);
     m_cacheId       = std::exchange(right.m_cacheId, 0);
+    m_uploadBuffers = std::move(right.m_uploadBuffers);
     return *this;
 }
 
@@ -410,21 +445,42 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
         // Make sure that the current texture binding will be preserved
         const priv::TextureSaver save;
 
-        // Copy the pixels to the texture, row by row
         const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.position.x + (size.x * rectangle.position.y));
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-        for (int i = 0; i < rectangle.size.y; ++i)
+
+        if (GLEXT_unpack_row_length)
         {
-            glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.size.x, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            pixels += 4 * size.x;
+            // Copy the pixels to the texture in a single call, skipping the rest of each image row
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, size.x));
+            glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                    0,
+                                    0,
+                                    0,
+                                    rectangle.size.x,
+                                    rectangle.size.y,
+                                    GL_RGBA,
+                                    GL_UNSIGNED_BYTE,
+                                    pixels));
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, 0));
+        }
+        else
+        {
+            // Copy the pixels to the texture, row by row
+            for (int i = 0; i < rectangle.size.y; ++i)
+            {
+                glCheck(
+                    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.size.x, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                pixels += 4 * size.x;
+            }
         }
 
         glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
         m_hasMipmap = false;
 
-        // Force an OpenGL flush, so that the texture will appear updated
+        // Flush if requested, so that the texture will appear updated
         // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+        if (m_flushOnUpdate)
+            glCheck(glFlush());
 
         return true;
     }
@@ -456,58 +512,20 @@ Image Texture::copyToImage() const
     // Create an array of pixels
     std::vector<std::uint8_t> pixels(m_size.x * m_size.y * 4);
 
-#ifdef SFML_OPENGL_ES
-
-    // OpenGL ES doesn't have the glGetTexImage function, the only way to read
-    // from a texture is to bind it to a FBO and use glReadPixels
-    GLuint frameBuffer = 0;
-    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
-    if (frameBuffer)
-    {
-        GLint previousFrameBuffer = 0;
-        glCheck(glGetIntegerv(GLEXT_GL_FRAMEBUFFER_BINDING, &previousFrameBuffer));
-
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
-        glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0));
-        glCheck(glReadPixels(0,
-                             0,
-                             static_cast<GLsizei>(m_size.x),
-                             static_cast<GLsizei>(m_size.y),
-                             GL_RGBA,
-                             GL_UNSIGNED_BYTE,
-                             pixels.data()));
-        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
-
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, static_cast<GLuint>(previousFrameBuffer)));
-
-        if (m_pixelsFlipped)
-        {
-            // Flip the texture vertically
-            const auto stride             = static_cast<std::ptrdiff_t>(m_size.x * 4);
-            auto       currentRowIterator = pixels.begin();
-            auto       nextRowIterator    = pixels.begin() + stride;
-            auto       reverseRowIterator = pixels.begin() + (stride * static_cast<std::ptrdiff_t>(m_size.y - 1));
-            for (unsigned int i = 0; i < m_size.y / 2; ++i)
-            {
-                std::swap_ranges(currentRowIterator, nextRowIterator, reverseRowIterator);
-                currentRowIterator = nextRowIterator;
-                nextRowIterator += stride;
-                reverseRowIterator -= stride;
-            }
-        }
-    }
-
-#else
+#ifndef SFML_OPENGL_ES
 
     if ((m_size == m_actualSize) && !m_pixelsFlipped)
     {
         // Texture is not padded nor flipped, we can use a direct copy
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
         glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+        return {m_size, pixels.data()};
     }
-    else
+
+    if (!GLEXT_framebuffer_object)
     {
-        // Texture is either padded or flipped, we have to use a slower algorithm
+        // Texture is either padded or flipped and we can't read a sub-area of it, we have to use a slower algorithm
 
         // All the pixels will first be copied to a temporary array
         std::vector<std::uint8_t> allPixels(m_actualSize.x * m_actualSize.y * 4);
@@ -533,11 +551,72 @@ Image Texture::copyToImage() const
             src += srcPitch;
             dst += dstPitch;
         }
+
+        return {m_size, pixels.data()};
     }
 
 #endif // SFML_OPENGL_ES
 
-    return {m_size, pixels.data()};
+    // Read only the useful pixels straight into the final array
+    // (OpenGL ES doesn't have the glGetTexImage function, this is the only way to read from a texture there)
+    const bool pixelsRead = readPixels(pixels.data());
+
+    Image image(m_size, pixels.data());
+    if (pixelsRead && m_pixelsFlipped)
+        image.flipVertically();
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback Texture::copyToImageAsync() const
+{
+    return TextureReadback(*this);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::readPixels(std::uint8_t* pixels) const
+{
+    // Bind the texture to a FBO and use glReadPixels, this reads only
+    // the public area of the texture, with tightly packed rows
+    GLuint frameBuffer = 0;
+    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+    if (!frameBuffer)
+        return false;
+
+    GLint previousFrameBuffer = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_FRAMEBUFFER_BINDING, &previousFrameBuffer));
+
+    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+    glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0));
+
+    // Some drivers can't attach every texture format, don't read from an incomplete framebuffer
+    GLenum status = 0;
+    glCheck(status = GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
+
+    const bool complete = (status == GLEXT_GL_FRAMEBUFFER_COMPLETE);
+    if (complete)
+    {
+        glCheck(glReadPixels(0,
+                             0,
+                             static_cast<GLsizei>(m_size.x),
+                             static_cast<GLsizei>(m_size.y),
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             pixels));
+    }
+    else
+    {
+        err() << "Failed to read texture pixels, failed to link texture to frame buffer" << std::endl;
+    }
+
+    glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+
+    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, static_cast<GLuint>(previousFrameBuffer)));
+
+    return complete;
 }
 
 
@@ -578,9 +657,10 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
         m_pixelsFlipped = false;
         m_cacheId       = TextureImpl::getUniqueId();
 
-        // Force an OpenGL flush, so that the texture data will appear updated
+        // Flush if requested, so that the texture data will appear updated
         // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+        if (m_flushOnUpdate)
+            glCheck(glFlush());
     }
 }
 
@@ -703,9 +783,10 @@ void Texture::update(const Texture& texture, Vector2u dest)
         m_pixelsFlipped = false;
         m_cacheId       = TextureImpl::getUniqueId();
 
-        // Force an OpenGL flush, so that the texture data will appear updated
+        // Flush if requested, so that the texture data will appear updated
         // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+        if (m_flushOnUpdate)
+            glCheck(glFlush());
 
         return;
     }
@@ -766,13 +847,124 @@ void Texture::update(const Window& window, Vector2u dest)
         m_pixelsFlipped = true;
         m_cacheId       = TextureImpl::getUniqueId();
 
-        // Force an OpenGL flush, so that the texture will appear updated
+        // Flush if requested, so that the texture will appear updated
         // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+        if (m_flushOnUpdate)
+            glCheck(glFlush());
     }
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    if (!pixels || !m_texture)
+        return;
+
+    const TransientContextLock lock;
+
+    // Without pixel buffer objects and fences, fall back to a synchronous upload
+    if (!GLEXT_pixel_buffer_object || !GLEXT_sync)
+    {
+        update(pixels, size, dest);
+        return;
+    }
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    if (!m_uploadBuffers)
+        m_uploadBuffers = std::make_unique<UploadBuffers>();
+
+    UploadBuffers::Slot& slot = m_uploadBuffers->slots[m_uploadBuffers->next];
+    m_uploadBuffers->next     = (m_uploadBuffers->next + 1) % m_uploadBuffers->slots.size();
+
+    if (!slot.buffer)
+        glCheck(GLEXT_glGenBuffers(1, &slot.buffer));
+
+    // Make sure that the current pixel unpack buffer binding will be preserved
+    GLint previousBuffer = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_PIXEL_UNPACK_BUFFER_BINDING, &previousBuffer));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, slot.buffer));
+
+    // If the previous upload from this buffer is still in flight, give the buffer new
+    // storage rather than waiting for it; the driver releases the old one when it's done
+    const std::size_t byteCount = std::size_t{size.x} * size.y * 4;
+    bool              busy      = false;
+    if (slot.fence)
+    {
+        GLenum status = 0;
+        glCheck(status = GLEXT_glClientWaitSync(slot.fence, 0, 0));
+        busy = (status == GLEXT_GL_TIMEOUT_EXPIRED);
+    }
+
+    if (busy || (slot.capacity < byteCount))
+    {
+        slot.capacity = std::max(slot.capacity, byteCount);
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(slot.capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptrARB>(byteCount), pixels));
+
+    // Source the upload from the pixel buffer, the driver performs it in the background
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(dest.x),
+                            static_cast<GLint>(dest.y),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(size.y),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            nullptr));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(previousBuffer)));
+
+    // Mark the point after which the buffer can be reused without new storage
+    if (slot.fence)
+        glCheck(GLEXT_glDeleteSync(slot.fence));
+
+    glCheck(slot.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    m_hasMipmap     = false;
+    m_pixelsFlipped = false;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    // Flush if requested, so that the texture data will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    if (m_flushOnUpdate)
+        glCheck(glFlush());
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::updateAsync(const Image& image, Vector2u dest)
+{
+    updateAsync(image.getPixelsPtr(), image.getSize(), dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::setFlushedOnUpdate(bool flush)
+{
+    m_flushOnUpdate = flush;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isFlushedOnUpdate() const
+{
+    return m_flushOnUpdate;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::setSmooth(bool smooth)
 {
@@ -1030,7 +1222,9 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_flushOnUpdate, right.m_flushOnUpdate);
     std::swap(m_cacheId, right.m_cacheId);
+    std::swap(m_uploadBuffers, right.m_uploadBuffers);
 }
 
 
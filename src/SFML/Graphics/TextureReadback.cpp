@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+
+#include <utility>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureReadback::Impl
+{
+    ~Impl()
+    {
+        if (!buffer && !fence)
+            return;
+
+        const TransientContextLock lock;
+
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(fence));
+
+        if (buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+    }
+
+    Image        image;           //!< Pixels that were copied synchronously, or already retrieved
+    Vector2u     size;            //!< Size of the texture when the copy was started
+    bool         pixelsFlipped{}; //!< Are the pixels in the buffer stored upside down?
+    GLuint       buffer{};        //!< Pixel buffer object receiving the pixels
+    GLEXT_GLsync fence{};         //!< Signaled once the pixels are in the buffer
+};
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback& TextureReadback::operator=(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(const Texture& texture) : m_impl(std::make_unique<Impl>())
+{
+    // Easy case: empty texture
+    if (!texture.m_texture)
+        return;
+
+    const TransientContextLock lock;
+
+    // Without pixel buffer objects, fences or framebuffer objects, fall back to a synchronous copy
+    if (!GLEXT_pixel_buffer_object || !GLEXT_sync || !GLEXT_framebuffer_object)
+    {
+        m_impl->image = texture.copyToImage();
+        return;
+    }
+
+    m_impl->size          = texture.m_size;
+    m_impl->pixelsFlipped = texture.m_pixelsFlipped;
+
+    // Make sure that the current pixel pack buffer binding will be preserved
+    GLint previousBuffer = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer));
+
+    // Read the pixels into a pixel buffer: glReadPixels returns as soon as the
+    // transfer is queued, instead of waiting for the pixels to be available
+    const std::size_t byteCount = std::size_t{m_impl->size.x} * m_impl->size.y * 4;
+    glCheck(GLEXT_glGenBuffers(1, &m_impl->buffer));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_impl->buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                               static_cast<GLsizeiptrARB>(byteCount),
+                               nullptr,
+                               GLEXT_GL_STREAM_READ));
+
+    const bool pixelsRead = texture.readPixels(nullptr);
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previousBuffer)));
+
+    if (!pixelsRead)
+    {
+        glCheck(GLEXT_glDeleteBuffers(1, &m_impl->buffer));
+        m_impl->buffer = 0;
+        m_impl->image  = texture.copyToImage();
+        return;
+    }
+
+    // Mark the point at which the pixels are in the buffer, and make sure that
+    // the commands are submitted even if nothing else flushes this context
+    glCheck(m_impl->fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    glCheck(glFlush());
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (!m_impl || !m_impl->fence)
+        return true;
+
+    const TransientContextLock lock;
+
+    GLenum status = 0;
+    glCheck(status = GLEXT_glClientWaitSync(m_impl->fence, 0, 0));
+    return status != GLEXT_GL_TIMEOUT_EXPIRED;
+}
+
+
+////////////////////////////////////////////////////////////
+Image TextureReadback::getImage()
+{
+    if (!m_impl)
+        return {};
+
+    if (m_impl->buffer)
+    {
+        const TransientContextLock lock;
+
+        // Wait for the transfer to complete, one second at a time
+        GLenum status = GLEXT_GL_TIMEOUT_EXPIRED;
+        while (status == GLEXT_GL_TIMEOUT_EXPIRED)
+            glCheck(status = GLEXT_glClientWaitSync(m_impl->fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000));
+
+        // Make sure that the current pixel pack buffer binding will be preserved
+        GLint previousBuffer = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer));
+
+        // Build the image straight from the mapped buffer, there is no intermediate copy
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_impl->buffer));
+
+        const void* pixels = nullptr;
+        glCheck(pixels = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+        if (pixels)
+        {
+            m_impl->image = Image(m_impl->size, static_cast<const std::uint8_t*>(pixels));
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+
+            if (m_impl->pixelsFlipped)
+                m_impl->image.flipVertically();
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previousBuffer)));
+    }
+
+    Image image = std::move(m_impl->image);
+    m_impl.reset();
+    return image;
+}
+
+} // namespace sf
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketHandle.hpp>
+
+#include <mutex>
+#include <unordered_set>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Set of the sockets that hold received data the
+///        system doesn't know about anymore
+///
+/// Sockets register their handle when they read ahead and
+/// unregister it once the data has been consumed or when they
+/// are closed, so that selectors only have to look at these
+/// sockets instead of asking every registered socket.
+///
+/// The set is global because sockets don't know the selectors
+/// that watch them (there may be several, or none), and
+/// selectors don't own their sockets. It only contains the
+/// sockets with unconsumed read-ahead data, which are few and
+/// short-lived, so scanning it in every `SocketSelector::wait`
+/// is cheap, and its mutex is only contended when sockets
+/// start or stop holding buffered data.
+///
+/// The sockets are identified by their handle, which moves
+/// along with their buffered data: moving a socket doesn't
+/// have to update the set.
+///
+////////////////////////////////////////////////////////////
+class BufferedSocketSet
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a socket to the set
+    ///
+    /// \param handle Native handle of the socket that holds buffered data
+    ///
+    ////////////////////////////////////////////////////////////
+    static void insert(SocketHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a socket from the set
+    ///
+    /// \param handle Native handle of the socket that doesn't hold buffered data anymore
+    ///
+    ////////////////////////////////////////////////////////////
+    static void erase(SocketHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for every socket of the set
+    ///
+    /// The set is locked during the whole iteration, so the
+    /// function must not add or remove sockets.
+    ///
+    /// \param func Function called with the handle of each socket
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    static void forEach(F&& func)
+    {
+        const std::lock_guard lock(getMutex());
+        for (const SocketHandle handle : getHandles())
+            func(handle);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the mutex protecting the set
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::mutex& getMutex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handles of the sockets of the set
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::unordered_set<SocketHandle>& getHandles();
+};
+
+} // namespace sf::priv
@@ -31,14 +31,23 @@
 #include <SFML/System/Utils.hpp>
 
 #include <algorithm>
-#include <iterator>
-#include <limits>
 #include <ostream>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include <cctype>
 #include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+bool isDigit(char character)
+{
+    return std::isdigit(static_cast<unsigned char>(character)) != 0;
+}
+} // namespace
 
 
 namespace sf
@@ -186,107 +195,327 @@ const std::string& Http::Response::getBody() const
 
 
 ////////////////////////////////////////////////////////////
-void Http::Response::parse(const std::string& data)
+// Incremental parser of a response: the received data is pushed
+// to it as it arrives, and the body is delivered without being
+// copied more than once
+////////////////////////////////////////////////////////////
+class Http::ResponseParser
 {
-    std::istringstream in(data);
+public:
+    ResponseParser(Response& response, Request::Method method, std::ostream* body) :
+        m_response(response),
+        m_method(method),
+        m_body(body)
+    {
+        m_response = Response();
+    }
 
-    // Extract the HTTP version from the first line
-    std::string version;
-    if (in >> version)
+    // Parse the given data; return the number of bytes that belong to the response
+    std::size_t feed(const char* data, std::size_t size)
     {
-        if ((version.size() >= 8) && (version[6] == '.') && (toLower(version.substr(0, 5)) == "http/") &&
-            std::isdigit(version[5]) && std::isdigit(version[7]))
+        m_hasData = m_hasData || (size > 0);
+
+        const char* const begin = data;
+        const char* const end   = data + size;
+        while ((data != end) && (m_state != State::Done))
         {
-            m_majorVersion = static_cast<unsigned int>(version[5] - '0');
-            m_minorVersion = static_cast<unsigned int>(version[7] - '0');
+            switch (m_state)
+            {
+                case State::Body:
+                case State::ChunkData:
+                {
+                    const auto count = static_cast<std::size_t>(
+                        std::min(m_remaining, static_cast<std::uint64_t>(end - data)));
+                    writeBody(data, count);
+                    data += count;
+                    m_remaining -= count;
+                    if (m_remaining == 0)
+                        m_state = (m_state == State::Body) ? State::Done : State::ChunkEnd;
+                    break;
+                }
+
+                case State::BodyUntilClose:
+                {
+                    writeBody(data, static_cast<std::size_t>(end - data));
+                    data = end;
+                    break;
+                }
+
+                default:
+                {
+                    if (readLine(data, end))
+                        processLine();
+                    break;
+                }
+            }
         }
-        else
+
+        return static_cast<std::size_t>(data - begin);
+    }
+
+    // Notify the parser that the connection was closed
+    void finish()
+    {
+        switch (m_state)
         {
-            // Invalid HTTP version
-            m_status = Status::InvalidResponse;
-            return;
+            // Without a complete header, it's not a valid HTTP response
+            case State::StatusLine:
+            case State::Fields:
+                m_response.m_status = Response::Status::InvalidResponse;
+                break;
+
+            // The connection was lost before the end of the body, what was received so far is kept
+            case State::Body:
+            case State::ChunkSize:
+            case State::ChunkData:
+            case State::ChunkEnd:
+                m_response.m_status = Response::Status::ConnectionFailed;
+                break;
+
+            default:
+                break;
         }
+
+        // If the body didn't have a known length, the end of the connection is the end of the body
+        m_keepAlive = false;
+        m_state     = State::Done;
     }
 
-    // Extract the status code from the first line
-    int status = 0;
-    if (in >> status)
+    [[nodiscard]] bool isDone() const
     {
-        m_status = static_cast<Status>(status);
+        return m_state == State::Done;
     }
-    else
+
+    [[nodiscard]] bool hasData() const
     {
-        // Invalid status code
-        m_status = Status::InvalidResponse;
-        return;
+        return m_hasData;
     }
 
-    // Ignore the end of the first line
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    [[nodiscard]] bool keepsConnection() const
+    {
+        return m_keepAlive;
+    }
 
-    // Parse the other lines, which contain fields, one by one
-    parseFields(in);
+private:
+    enum class State
+    {
+        StatusLine,     //!< Waiting for the first line of the response
+        Fields,         //!< Reading the header fields
+        Body,           //!< Reading a body of known length
+        BodyUntilClose, //!< Reading a body that ends with the connection
+        ChunkSize,      //!< Reading the size of the next chunk
+        ChunkData,      //!< Reading the data of a chunk
+        ChunkEnd,       //!< Reading the end of line that follows the data of a chunk
+        Trailers,       //!< Reading the fields that follow the last chunk
+        Done            //!< The response is complete
+    };
+
+    // Accumulate the next line; return true once it is complete
+    bool readLine(const char*& data, const char* end)
+    {
+        const char* const lineEnd = std::find(data, end, '\n');
+        m_line.append(data, lineEnd);
 
-    m_body.clear();
+        if (lineEnd == end)
+        {
+            data = end;
+            return false;
+        }
 
-    // Determine whether the transfer is chunked
-    if (toLower(getField("transfer-encoding")) != "chunked")
-    {
-        // Not chunked - just read everything at once
-        std::copy(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(), std::back_inserter(m_body));
+        // Remove any trailing \r
+        if (!m_line.empty() && (m_line.back() == '\r'))
+            m_line.pop_back();
+
+        data = lineEnd + 1;
+        return true;
     }
-    else
+
+    void processLine()
     {
-        // Chunked - have to read chunk by chunk
-        std::size_t length = 0;
+        switch (m_state)
+        {
+            case State::StatusLine:
+                parseStatusLine();
+                break;
+
+            case State::Fields:
+                if (m_line.empty())
+                    startBody();
+                else
+                    parseField();
+                break;
+
+            case State::ChunkSize:
+                parseChunkSize();
+                break;
+
+            case State::ChunkEnd:
+                m_state = State::ChunkSize;
+                break;
+
+            case State::Trailers:
+                if (m_line.empty())
+                    m_state = State::Done;
+                else
+                    parseField();
+                break;
+
+            default:
+                break;
+        }
 
-        // Read all chunks, identified by a chunk-size not being 0
-        while (in >> std::hex >> length)
+        m_line.clear();
+    }
+
+    void parseStatusLine()
+    {
+        // Extract the HTTP version from the first line
+        const std::string version = m_line.substr(0, m_line.find(' '));
+        if ((version.size() >= 8) && (version[6] == '.') && (toLower(version.substr(0, 5)) == "http/") &&
+            isDigit(version[5]) && isDigit(version[7]))
         {
-            // Drop the rest of the line (chunk-extension)
-            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            m_response.m_majorVersion = static_cast<unsigned int>(version[5] - '0');
+            m_response.m_minorVersion = static_cast<unsigned int>(version[7] - '0');
+        }
+        else
+        {
+            // Invalid HTTP version
+            invalidate();
+            return;
+        }
 
-            // Copy the actual content data
-            std::istreambuf_iterator<char>       it(in);
-            const std::istreambuf_iterator<char> itEnd;
-            for (std::size_t i = 0; ((i < length) && (it != itEnd)); ++i)
-            {
-                m_body.push_back(*it);
-                ++it; // Iterate in separate expression to work around false positive -Wnull-dereference warning in GCC 12.1.0
-            }
+        // Extract the status code from the first line
+        std::size_t pos    = m_line.find_first_not_of(' ', version.size());
+        int         status = 0;
+        if ((pos == std::string::npos) || !isDigit(m_line[pos]))
+        {
+            // Invalid status code
+            invalidate();
+            return;
         }
 
-        // Drop the rest of the line (chunk-extension)
-        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        for (; (pos < m_line.size()) && isDigit(m_line[pos]) && (status < 10000); ++pos)
+            status = status * 10 + (m_line[pos] - '0');
 
-        // Read all trailers (if present)
-        parseFields(in);
+        m_response.m_status = static_cast<Response::Status>(status);
+        m_state             = State::Fields;
     }
-}
-
 
-////////////////////////////////////////////////////////////
-void Http::Response::parseFields(std::istream& in)
-{
-    std::string line;
-    while (std::getline(in, line) && (line.size() > 2))
+    void parseField()
     {
-        const std::string::size_type pos = line.find(": ");
+        const std::string::size_type pos = m_line.find(':');
         if (pos != std::string::npos)
         {
             // Extract the field name and its value
-            const std::string field = line.substr(0, pos);
-            std::string       value = line.substr(pos + 2);
-
-            // Remove any trailing \r
-            if (!value.empty() && (*value.rbegin() == '\r'))
-                value.erase(value.size() - 1);
+            const std::string::size_type valuePos = m_line.find_first_not_of(" \t", pos + 1);
+            const std::string            field    = m_line.substr(0, pos);
+            std::string value = (valuePos != std::string::npos) ? m_line.substr(valuePos) : std::string();
 
             // Add the field
-            m_fields[toLower(field)] = value;
+            m_response.m_fields[toLower(field)] = std::move(value);
         }
     }
-}
+
+    void startBody()
+    {
+        const int status = static_cast<int>(m_response.m_status);
+
+        // Informational responses (like "100 Continue") are followed by the actual response
+        if ((status >= 100) && (status < 200))
+        {
+            m_response.m_fields.clear();
+            m_state = State::StatusLine;
+            return;
+        }
+
+        // Tell whether the server keeps the connection open after this response
+        const std::string connection = toLower(m_response.getField("connection"));
+        if ((m_response.m_majorVersion * 10 + m_response.m_minorVersion) >= 11)
+            m_keepAlive = connection != "close";
+        else
+            m_keepAlive = connection == "keep-alive";
+
+        // Determine how the end of the body is marked
+        const std::string& length = m_response.getField("content-length");
+        if ((m_method == Request::Method::Head) || (status == 204) || (status == 304))
+        {
+            // There is no body at all
+            m_state = State::Done;
+        }
+        else if (toLower(m_response.getField("transfer-encoding")) == "chunked")
+        {
+            // Chunked - have to read chunk by chunk
+            m_state = State::ChunkSize;
+        }
+        else if (!length.empty() && (length.size() < 20) && std::all_of(length.begin(), length.end(), isDigit))
+        {
+            // The size of the body is known
+            m_remaining = 0;
+            for (const char digit : length)
+                m_remaining = m_remaining * 10 + static_cast<std::uint64_t>(digit - '0');
+
+            m_state = (m_remaining > 0) ? State::Body : State::Done;
+            if (!m_body && (m_remaining < maxReservedBody))
+                m_response.m_body.reserve(static_cast<std::size_t>(m_remaining));
+        }
+        else
+        {
+            // The body ends with the connection
+            m_keepAlive = false;
+            m_state     = State::BodyUntilClose;
+        }
+    }
+
+    void parseChunkSize()
+    {
+        // Read the chunk size in hexadecimal, ignoring the chunk extension that may follow
+        std::uint64_t length = 0;
+        std::size_t   pos    = 0;
+        for (; (pos < m_line.size()) && (pos < 16) && std::isxdigit(static_cast<unsigned char>(m_line[pos])); ++pos)
+        {
+            const auto digit = static_cast<char>(std::tolower(static_cast<unsigned char>(m_line[pos])));
+            length = length * 16 + static_cast<std::uint64_t>(isDigit(digit) ? digit - '0' : digit - 'a' + 10);
+        }
+
+        if (pos == 0)
+        {
+            // Invalid chunk size
+            invalidate();
+            return;
+        }
+
+        // A chunk of size 0 marks the end of the body, it may be followed by trailers
+        m_remaining = length;
+        m_state     = (length > 0) ? State::ChunkData : State::Trailers;
+    }
+
+    void writeBody(const char* data, std::size_t size)
+    {
+        if (m_body)
+            m_body->write(data, static_cast<std::streamsize>(size));
+        else
+            m_response.m_body.append(data, size);
+    }
+
+    void invalidate()
+    {
+        m_response.m_status = Response::Status::InvalidResponse;
+        m_keepAlive         = false;
+        m_state             = State::Done;
+    }
+
+    // Bodies announced bigger than this are not reserved up front
+    static constexpr std::uint64_t maxReservedBody = 64 * 1024 * 1024;
+
+    Response&       m_response;                 //!< Response being filled
+    Request::Method m_method;                   //!< Method of the request, some responses depend on it
+    std::ostream*   m_body;                     //!< Stream receiving the body, if it isn't stored in the response
+    State           m_state{State::StatusLine}; //!< Current step of the parsing
+    std::string     m_line;                     //!< Line being received
+    std::uint64_t   m_remaining{};              //!< Number of bytes of the body or chunk left to receive
+    bool            m_keepAlive{};              //!< Does the server keep the connection open after the response?
+    bool            m_hasData{};                //!< Was some data received?
+};
 
 
 ////////////////////////////////////////////////////////////
@@ -325,13 +554,60 @@ void Http::setHost(const std::string& host, unsigned short port)
         m_hostName.erase(m_hostName.size() - 1);
 
     m_host = IpAddress::resolve(m_hostName);
+
+    // A connection kept alive with the previous host is useless now
+    m_connection.disconnect();
+    m_received.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
 {
-    // First make sure that the request is valid -- add missing mandatory fields
+    Response response;
+    exchange(&request, &response, 1, nullptr, timeout);
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Http::Request& request, std::ostream& body, Time timeout)
+{
+    Response response;
+    exchange(&request, &response, 1, &body, timeout);
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests, Time timeout)
+{
+    std::vector<Response> responses(requests.size());
+
+    // If the server closes the connection before answering all the
+    // requests, send the ones left again on a new connection
+    std::size_t done = 0;
+    while (done < requests.size())
+    {
+        const std::size_t count = exchange(requests.data() + done,
+                                           responses.data() + done,
+                                           requests.size() - done,
+                                           nullptr,
+                                           timeout);
+        if (count == 0)
+            break;
+
+        done += count;
+    }
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Request Http::completeRequest(const Request& request) const
+{
+    // Make sure that the request is valid -- add missing mandatory fields
     Request toSend(request);
     if (!toSend.hasField("From"))
     {
@@ -355,44 +631,90 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
     {
         toSend.setField("Content-Type", "application/x-www-form-urlencoded");
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
+
+    return toSend;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Http::exchange(const Request* requests,
+                           Response*      responses,
+                           std::size_t    count,
+                           std::ostream*  body,
+                           Time           timeout)
+{
+    // Reuse the connection kept alive by the previous request, if any
+    const bool reused = m_connection.getRemoteAddress().has_value();
+    if (!reused)
     {
-        toSend.setField("Connection", "close");
+        m_received.clear();
+
+        // Connect the socket to the host
+        if (!m_host.has_value() || (m_connection.connect(*m_host, m_port, timeout) != Socket::Status::Done))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                responses[i] = Response();
+
+            return 0;
+        }
     }
 
-    // Prepare the response
-    Response received;
+    // Convert the requests to a string and send them all at once through the connected socket
+    std::string requestStr;
+    for (std::size_t i = 0; i < count; ++i)
+        requestStr += completeRequest(requests[i]).prepare();
+
+    if (m_connection.send(requestStr.c_str(), requestStr.size()) != Socket::Status::Done)
+    {
+        m_connection.disconnect();
+
+        // The server may have closed a connection that we kept alive: try again with a new one
+        return reused ? exchange(requests, responses, count, body, timeout) : 0;
+    }
 
-    // Connect the socket to the host
-    if (m_connection.connect(m_host.value(), m_port, timeout) == Socket::Status::Done)
+    // Receive the responses one after the other
+    std::vector<char> buffer(16384);
+    for (std::size_t i = 0; i < count; ++i)
     {
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
+        ResponseParser parser(responses[i], requests[i].m_method, body);
+
+        // Start with the data received after the previous response
+        const std::size_t used = parser.feed(m_received.data(), m_received.size());
+        m_received.erase(0, used);
 
-        if (!requestStr.empty())
+        // Wait for the server's response
+        std::size_t size = 0;
+        while (!parser.isDone())
         {
-            // Send it through the socket
-            if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
+            if (m_connection.receive(buffer.data(), buffer.size(), size) != Socket::Status::Done)
             {
-                // Wait for the server's response
-                std::string receivedStr;
-                std::size_t size = 0;
-                char        buffer[1024];
-                while (m_connection.receive(buffer, sizeof(buffer), size) == Socket::Status::Done)
-                {
-                    receivedStr.append(buffer, buffer + size);
-                }
+                m_connection.disconnect();
+
+                // The server may have closed a connection that we kept alive: try again with a new one
+                if (reused && (i == 0) && !parser.hasData())
+                    return exchange(requests, responses, count, body, timeout);
 
-                // Build the Response object from the received data
-                received.parse(receivedStr);
+                parser.finish();
+                return i + 1;
             }
+
+            // Keep what follows the end of the response for the next one
+            const std::size_t parsed = parser.feed(buffer.data(), size);
+            m_received.append(buffer.data() + parsed, size - parsed);
         }
 
-        // Close the connection
-        m_connection.disconnect();
+        // Close the connection if the server or the request asked for it
+        const Request&    request    = requests[i];
+        const std::string connection = request.hasField("Connection") ? toLower(request.m_fields.at("connection")) : "";
+        const bool persistent = (request.m_majorVersion * 10 + request.m_minorVersion >= 11) && (connection != "close");
+        if (!parser.keepsConnection() || !persistent)
+        {
+            m_connection.disconnect();
+            return i + 1;
+        }
     }
 
-    return received;
+    return count;
 }
 
 } // namespace sf
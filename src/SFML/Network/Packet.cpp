@@ -26,20 +26,130 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketPool.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <array>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include <cassert>
 #include <cstring>
 #include <cwchar>
 
 
+namespace
+{
+// Convert values to the network byte order (big endian), whatever the byte order of the host;
+// compilers turn these loops into byte swaps, vectorized when possible
+template <typename T>
+void toNetworkOrder(const T* values, std::size_t count, std::byte* bytes)
+{
+    using Unsigned = std::make_unsigned_t<T>;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto value = static_cast<Unsigned>(values[i]);
+        for (std::size_t j = 0; j < sizeof(T); ++j)
+            bytes[i * sizeof(T) + j] = static_cast<std::byte>(value >> (8 * (sizeof(T) - 1 - j)));
+    }
+}
+
+// Convert values from the network byte order (big endian), whatever the byte order of the host
+template <typename T>
+void fromNetworkOrder(const std::byte* bytes, std::size_t count, T* values)
+{
+    using Unsigned = std::make_unsigned_t<T>;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Unsigned value = 0;
+        for (std::size_t j = 0; j < sizeof(T); ++j)
+            value = static_cast<Unsigned>((value << 8) | static_cast<Unsigned>(bytes[i * sizeof(T) + j]));
+        values[i] = static_cast<T>(value);
+    }
+}
+} // namespace
+
+
 namespace sf
 {
+////////////////////////////////////////////////////////////
+Packet::Packet(PacketPool& pool) : m_data(pool.acquire()), m_pool(&pool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::~Packet()
+{
+    // Give the buffer back to the pool that lent it
+    if (m_pool)
+        m_pool->release(std::move(m_data));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Packet(const Packet& packet) :
+m_data(packet.m_pool ? packet.m_pool->acquire() : std::vector<std::byte>()),
+m_readPos(packet.m_readPos),
+m_sendPos(packet.m_sendPos),
+m_isValid(packet.m_isValid),
+m_pool(packet.m_pool)
+{
+    m_data.assign(packet.m_data.begin(), packet.m_data.end());
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::operator=(const Packet& packet)
+{
+    if (this != &packet)
+    {
+        m_data.assign(packet.m_data.begin(), packet.m_data.end());
+        m_readPos = packet.m_readPos;
+        m_sendPos = packet.m_sendPos;
+        m_isValid = packet.m_isValid;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Packet(Packet&& packet) noexcept :
+m_data(std::move(packet.m_data)),
+m_readPos(packet.m_readPos),
+m_sendPos(packet.m_sendPos),
+m_isValid(packet.m_isValid),
+m_pool(std::exchange(packet.m_pool, nullptr))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::operator=(Packet&& packet) noexcept
+{
+    // Swap the buffers, so that each one is given back to its own pool
+    std::swap(m_data, packet.m_data);
+    std::swap(m_pool, packet.m_pool);
+    m_readPos = packet.m_readPos;
+    m_sendPos = packet.m_sendPos;
+    m_isValid = packet.m_isValid;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t sizeInBytes)
+{
+    m_data.reserve(sizeInBytes);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Packet::append(const void* data, std::size_t sizeInBytes)
 {
@@ -309,12 +419,7 @@ Packet& Packet::operator>>(wchar_t* data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data[i] = static_cast<wchar_t>(character);
-        }
+        readCharacters(data, length);
         data[length] = L'\0';
     }
 
@@ -333,12 +438,8 @@ Packet& Packet::operator>>(std::wstring& data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<wchar_t>(character);
-        }
+        data.resize(length);
+        readCharacters(data.data(), length);
     }
 
     return *this;
@@ -356,12 +457,9 @@ Packet& Packet::operator>>(String& data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<char32_t>(character);
-        }
+        std::u32string characters(length, U'\0');
+        readCharacters(characters.data(), length);
+        data = String(std::move(characters));
     }
 
     return *this;
@@ -525,8 +623,7 @@ Packet& Packet::operator<<(const wchar_t* data)
     *this << length;
 
     // Then insert characters
-    for (const wchar_t* c = data; *c != L'\0'; ++c)
-        *this << static_cast<std::uint32_t>(*c);
+    writeCharacters(data, length);
 
     return *this;
 }
@@ -540,11 +637,7 @@ Packet& Packet::operator<<(const std::wstring& data)
     *this << length;
 
     // Then insert characters
-    if (length > 0)
-    {
-        for (const wchar_t c : data)
-            *this << static_cast<std::uint32_t>(c);
-    }
+    writeCharacters(data.data(), length);
 
     return *this;
 }
@@ -558,16 +651,230 @@ Packet& Packet::operator<<(const String& data)
     *this << length;
 
     // Then insert characters
-    if (length > 0)
+    writeCharacters(data.getData(), length);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int8_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint8_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int16_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint16_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int32_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint32_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int64_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint64_t* data, std::size_t count)
+{
+    return readValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(float* data, std::size_t count)
+{
+    // Floating point numbers are stored as they are, like with operator>>
+    if ((count > 0) && checkSize(count * sizeof(*data)))
     {
-        for (const unsigned int datum : data)
-            *this << datum;
+        std::memcpy(data, &m_data[m_readPos], count * sizeof(*data));
+        m_readPos += count * sizeof(*data);
     }
 
     return *this;
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(double* data, std::size_t count)
+{
+    // Floating point numbers are stored as they are, like with operator>>
+    if ((count > 0) && checkSize(count * sizeof(*data)))
+    {
+        std::memcpy(data, &m_data[m_readPos], count * sizeof(*data));
+        m_readPos += count * sizeof(*data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int8_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint8_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int16_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint16_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int32_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint32_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int64_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint64_t* data, std::size_t count)
+{
+    return writeValues(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const float* data, std::size_t count)
+{
+    // Floating point numbers are stored as they are, like with operator<<
+    append(data, count * sizeof(*data));
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const double* data, std::size_t count)
+{
+    // Floating point numbers are stored as they are, like with operator<<
+    append(data, count * sizeof(*data));
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Packet& Packet::readValues(T* data, std::size_t count)
+{
+    if ((count > 0) && checkSize(count * sizeof(T)))
+    {
+        fromNetworkOrder(&m_data[m_readPos], count, data);
+        m_readPos += count * sizeof(T);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Packet& Packet::writeValues(const T* data, std::size_t count)
+{
+    if (data && (count > 0))
+    {
+        const std::size_t offset = m_data.size();
+        m_data.resize(offset + count * sizeof(T));
+        toNetworkOrder(data, count, &m_data[offset]);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Char>
+void Packet::readCharacters(Char* data, std::size_t length)
+{
+    // Characters are stored as 32-bit integers, whatever the size of the character type
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        std::uint32_t character = 0;
+        fromNetworkOrder(&m_data[m_readPos + i * sizeof(character)], 1, &character);
+        data[i] = static_cast<Char>(character);
+    }
+
+    m_readPos += length * sizeof(std::uint32_t);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Char>
+void Packet::writeCharacters(const Char* data, std::size_t length)
+{
+    // Characters are stored as 32-bit integers, whatever the size of the character type
+    const std::size_t offset = m_data.size();
+    m_data.resize(offset + length * sizeof(std::uint32_t));
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        const auto character = static_cast<std::uint32_t>(data[i]);
+        toNetworkOrder(&character, 1, &m_data[offset + i * sizeof(character)]);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
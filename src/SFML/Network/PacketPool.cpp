@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketPool.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+
+namespace
+{
+// Buffers that grew beyond this multiple of the capacity of the pool are freed when given back
+constexpr std::size_t maxCapacityFactor = 4;
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct PacketPool::Impl
+{
+    std::size_t                         bufferCapacity{}; //!< Number of bytes reserved in each buffer
+    std::size_t                         maxFreeBuffers{}; //!< Maximum number of free buffers kept for reuse
+    mutable std::mutex                  mutex;            //!< Mutex protecting the free buffers and the statistics
+    std::vector<std::vector<std::byte>> freeBuffers;      //!< Buffers waiting to be borrowed
+    Statistics                          statistics;       //!< Counters describing the use of the pool
+};
+
+
+////////////////////////////////////////////////////////////
+PacketPool::PacketPool(std::size_t bufferCapacity, std::size_t maxFreeBuffers) : m_impl(std::make_unique<Impl>())
+{
+    m_impl->bufferCapacity = bufferCapacity;
+    m_impl->maxFreeBuffers = maxFreeBuffers;
+
+    // Make sure that giving a buffer back never needs an allocation
+    m_impl->freeBuffers.reserve(maxFreeBuffers);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketPool::~PacketPool() = default;
+
+
+////////////////////////////////////////////////////////////
+void PacketPool::reserve(std::size_t count)
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    while (m_impl->freeBuffers.size() < std::min(count, m_impl->maxFreeBuffers))
+    {
+        std::vector<std::byte> buffer;
+        buffer.reserve(m_impl->bufferCapacity);
+        m_impl->freeBuffers.push_back(std::move(buffer));
+        ++m_impl->statistics.allocatedBuffers;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketPool::getBufferCapacity() const
+{
+    return m_impl->bufferCapacity;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketPool::Statistics PacketPool::getStatistics() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    Statistics statistics  = m_impl->statistics;
+    statistics.freeBuffers = m_impl->freeBuffers.size();
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::byte> PacketPool::acquire()
+{
+    {
+        const std::lock_guard lock(m_impl->mutex);
+
+        ++m_impl->statistics.borrowedBuffers;
+        if (!m_impl->freeBuffers.empty())
+        {
+            std::vector<std::byte> buffer = std::move(m_impl->freeBuffers.back());
+            m_impl->freeBuffers.pop_back();
+            ++m_impl->statistics.reusedBuffers;
+            return buffer;
+        }
+
+        ++m_impl->statistics.allocatedBuffers;
+    }
+
+    // Allocate a new buffer outside of the lock
+    std::vector<std::byte> buffer;
+    buffer.reserve(m_impl->bufferCapacity);
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketPool::release(std::vector<std::byte>&& buffer)
+{
+    buffer.clear();
+
+    const std::lock_guard lock(m_impl->mutex);
+
+    --m_impl->statistics.borrowedBuffers;
+
+    // Buffers that lost their memory are useless, buffers that grew for a big packet would keep
+    // their memory forever, and the pool doesn't grow beyond its maximum
+    const std::size_t capacity = buffer.capacity();
+    if ((capacity >= m_impl->bufferCapacity) && (capacity <= m_impl->bufferCapacity * maxCapacityFactor) &&
+        (m_impl->freeBuffers.size() < m_impl->maxFreeBuffers))
+        m_impl->freeBuffers.push_back(std::move(buffer));
+    else
+        ++m_impl->statistics.discardedBuffers;
+}
+
+} // namespace sf
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/BufferedSocketSet.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
@@ -54,7 +55,8 @@ Socket::~Socket()
 Socket::Socket(Socket&& socket) noexcept :
 m_type(socket.m_type),
 m_socket(std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket())),
-m_isBlocking(socket.m_isBlocking)
+m_isBlocking(socket.m_isBlocking),
+m_hasBufferedData(std::exchange(socket.m_hasBufferedData, false))
 {
 }
 
@@ -67,9 +69,11 @@ Socket& Socket::operator=(Socket&& socket) noexcept
 
     close();
 
-    m_type       = socket.m_type;
-    m_socket     = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
-    m_isBlocking = socket.m_isBlocking;
+    m_type            = socket.m_type;
+    m_socket          = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
+    m_isBlocking      = socket.m_isBlocking;
+    m_hasBufferedData = std::exchange(socket.m_hasBufferedData, false);
+
     return *this;
 }
 
@@ -167,9 +171,27 @@ void Socket::close()
     // Close the socket
     if (m_socket != priv::SocketImpl::invalidSocket())
     {
+        // Whatever was received ahead belonged to the closed socket
+        setHasBufferedData(false);
+
         priv::SocketImpl::close(m_socket);
         m_socket = priv::SocketImpl::invalidSocket();
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Socket::setHasBufferedData(bool hasBufferedData)
+{
+    if (hasBufferedData == m_hasBufferedData)
+        return;
+
+    if (hasBufferedData)
+        priv::BufferedSocketSet::insert(m_socket);
+    else
+        priv::BufferedSocketSet::erase(m_socket);
+
+    m_hasBufferedData = hasBufferedData;
+}
+
 } // namespace sf
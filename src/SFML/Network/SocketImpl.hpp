@@ -45,12 +45,12 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
-#include <cstddef>
-
 #endif
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -75,6 +75,16 @@ public:
     using Size       = std::size_t;
 #endif
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Block of bytes to send with `sendBuffers`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+        const std::byte* data{}; //!< Bytes to send
+        std::size_t      size{}; //!< Number of bytes to send
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
     ///
@@ -111,6 +121,23 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several blocks of bytes with a single system call
+    ///
+    /// The blocks are sent in order, as if they were contiguous.
+    /// Only the first blocks are sent if there are more than the
+    /// operating system can handle at once.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Blocks of bytes to send
+    /// \param count   Number of blocks
+    /// \param flags   Flags of the send operation
+    ///
+    /// \return Number of bytes sent, or -1 if an error happened
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::int64_t sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
@@ -25,15 +25,27 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/BufferedSocketSet.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_SOCKET_SELECTOR_EPOLL
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
@@ -42,13 +54,104 @@
 
 namespace sf
 {
+#ifdef SFML_SOCKET_SELECTOR_EPOLL
+
+////////////////////////////////////////////////////////////
+// epoll implementation: the kernel keeps the set of sockets, so waiting
+// doesn't copy it, only the ready sockets are reported and there is no
+// limit on the value of the socket handles
+////////////////////////////////////////////////////////////
+struct SocketSelector::SocketSelectorImpl
+{
+    struct Entry
+    {
+        Socket* socket{}; //!< Socket registered with the handle
+        bool    ready{};  //!< Was the socket ready after the last wait?
+    };
+
+    SocketSelectorImpl() : epoll(epoll_create1(EPOLL_CLOEXEC))
+    {
+        if (epoll < 0)
+            err() << "Failed to create the epoll instance of the socket selector" << std::endl;
+    }
+
+    SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
+    {
+        for (const auto& [handle, entry] : copy.sockets)
+            add(handle, entry.socket);
+
+        // Keep the result of the last wait
+        for (auto& [handle, entry] : sockets)
+            entry.ready = copy.sockets.at(handle).ready;
+
+        readyHandles = copy.readyHandles;
+        readySockets = copy.readySockets;
+    }
+
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    ~SocketSelectorImpl()
+    {
+        if (epoll >= 0)
+            ::close(epoll);
+    }
+
+    void add(SocketHandle handle, Socket* socket)
+    {
+        const auto [it, inserted] = sockets.try_emplace(handle, Entry{socket});
+        if (!inserted)
+        {
+            // The handle is already known: either the same socket is added again, or the previous
+            // socket was closed without being removed and the system reused its handle for this one
+            if (it->second.ready)
+                std::replace(readySockets.begin(), readySockets.end(), it->second.socket, socket);
+
+            it->second.socket = socket;
+        }
+
+        // Closing a handle removes it from the epoll set, so it must be registered again
+        // in any case (if it's still there, only its settings are updated)
+        epoll_event event{};
+        event.events  = EPOLLIN;
+        event.data.fd = handle;
+        if ((epoll_ctl(epoll, EPOLL_CTL_ADD, handle, &event) != 0) &&
+            ((errno != EEXIST) || (epoll_ctl(epoll, EPOLL_CTL_MOD, handle, &event) != 0)))
+        {
+            err() << "The socket can't be added to the selector: epoll_ctl failed" << std::endl;
+            if (it->second.ready)
+                readySockets.erase(std::remove(readySockets.begin(), readySockets.end(), socket), readySockets.end());
+
+            sockets.erase(it);
+        }
+    }
+
+    int                                     epoll{-1};    //!< Handle of the epoll instance
+    std::unordered_map<SocketHandle, Entry> sockets;      //!< Sockets registered in the selector, by handle
+    std::vector<epoll_event>                events;       //!< Buffer receiving the events of the ready sockets
+    std::vector<SocketHandle>               readyHandles; //!< Handles of the sockets that were ready after the last wait
+    std::vector<Socket*>                    readySockets; //!< Sockets that were ready after the last wait
+};
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
+{
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+// select implementation
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets{};   //!< Set containing all the sockets handles
-    fd_set socketsReady{}; //!< Set containing handles of the sockets that are ready
-    int    maxSocket{};    //!< Maximum socket handle
-    int    socketCount{};  //!< Number of socket handles
+    fd_set                                    allSockets{};    //!< Set containing all the sockets handles
+    fd_set                                    socketsReady{};  //!< Set containing handles of the sockets that are ready
+    int                                       maxSocket{};     //!< Maximum socket handle
+    int                                       socketCount{};   //!< Number of socket handles
+    std::unordered_map<SocketHandle, Socket*> sockets;         //!< Sockets registered in the selector, by handle
+    std::vector<Socket*>                      readySockets;    //!< Sockets that were ready after the last wait
+    std::vector<SocketHandle>                 bufferedHandles; //!< Handles of the sockets holding data received ahead
 };
 
 
@@ -58,6 +161,8 @@ SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>()
     clear();
 }
 
+#endif
+
 
 ////////////////////////////////////////////////////////////
 SocketSelector::~SocketSelector() = default;
@@ -86,12 +191,131 @@ SocketSelector::SocketSelector(SocketSelector&&) noexcept = default;
 SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
 
 
+#ifdef SFML_SOCKET_SELECTOR_EPOLL
+
+////////////////////////////////////////////////////////////
+void SocketSelector::add(Socket& socket)
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+        m_impl->add(handle, &socket);
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::remove(Socket& socket)
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle == priv::SocketImpl::invalidSocket())
+        return;
+
+    const auto it = m_impl->sockets.find(handle);
+    if (it == m_impl->sockets.end())
+        return;
+
+    // The socket may already have been removed from the epoll set if it was closed
+    epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, handle, nullptr);
+
+    if (it->second.ready)
+    {
+        auto& readySockets = m_impl->readySockets;
+        readySockets.erase(std::remove(readySockets.begin(), readySockets.end(), it->second.socket), readySockets.end());
+    }
+
+    m_impl->sockets.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::clear()
+{
+    for (const auto& [handle, entry] : m_impl->sockets)
+        epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, handle, nullptr);
+
+    m_impl->sockets.clear();
+    m_impl->readySockets.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::wait(Time timeout)
+{
+    // Forget about the sockets that were ready after the previous wait
+    for (const SocketHandle handle : m_impl->readyHandles)
+    {
+        const auto it = m_impl->sockets.find(handle);
+        if (it != m_impl->sockets.end())
+            it->second.ready = false;
+    }
+
+    m_impl->readyHandles.clear();
+    m_impl->readySockets.clear();
+
+    const auto setReady = [this](SocketHandle handle, SocketSelectorImpl::Entry& entry)
+    {
+        if (!entry.ready)
+        {
+            entry.ready = true;
+            m_impl->readyHandles.push_back(handle);
+            m_impl->readySockets.push_back(entry.socket);
+        }
+    };
+
+    // Sockets that have data buffered on their side are ready, whatever the system says
+    priv::BufferedSocketSet::forEach(
+        [this, &setReady](SocketHandle handle)
+        {
+            if (const auto it = m_impl->sockets.find(handle); it != m_impl->sockets.end())
+                setReady(handle, it->second);
+        });
+
+    // Make room for all the sockets to be reported at once
+    m_impl->events.resize(std::max<std::size_t>(m_impl->sockets.size(), 1));
+
+    // Wait until one of the sockets is ready for reading, or timeout is reached (rounded up to the next millisecond);
+    // don't wait at all if we already know about ready sockets
+    int milliseconds = timeout != Time::Zero ? static_cast<int>((timeout.asMicroseconds() + 999) / 1000) : -1;
+    if (!m_impl->readySockets.empty())
+        milliseconds = 0;
+
+    const int count = epoll_wait(m_impl->epoll, m_impl->events.data(), static_cast<int>(m_impl->events.size()), milliseconds);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const SocketHandle handle = m_impl->events[static_cast<std::size_t>(i)].data.fd;
+        const auto         it     = m_impl->sockets.find(handle);
+        if (it != m_impl->sockets.end())
+            setReady(handle, it->second);
+    }
+
+    return !m_impl->readySockets.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReady(Socket& socket) const
+{
+    const auto it = m_impl->sockets.find(socket.getNativeHandle());
+    return (it != m_impl->sockets.end()) && it->second.ready;
+}
+
+#else
+
 ////////////////////////////////////////////////////////////
 void SocketSelector::add(Socket& socket)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        // The handle is already known: either the same socket is added again, or the previous
+        // socket was closed without being removed and the system reused its handle for this one
+        if (const auto it = m_impl->sockets.find(handle); it != m_impl->sockets.end())
+        {
+            auto& readySockets = m_impl->readySockets;
+            std::replace(readySockets.begin(), readySockets.end(), it->second, &socket);
+            it->second = &socket;
+            return;
+        }
 
 #if defined(SFML_SYSTEM_WINDOWS)
 
@@ -125,6 +349,7 @@ void SocketSelector::add(Socket& socket)
 #endif
 
         FD_SET(handle, &m_impl->allSockets);
+        m_impl->sockets[handle] = &socket;
     }
 }
 
@@ -150,8 +375,16 @@ void SocketSelector::remove(Socket& socket)
 
 #endif
 
+        if (FD_ISSET(handle, &m_impl->socketsReady))
+        {
+            auto& readySockets = m_impl->readySockets;
+            readySockets.erase(std::remove(readySockets.begin(), readySockets.end(), m_impl->sockets[handle]),
+                               readySockets.end());
+        }
+
         FD_CLR(handle, &m_impl->allSockets);
         FD_CLR(handle, &m_impl->socketsReady);
+        m_impl->sockets.erase(handle);
     }
 }
 
@@ -164,6 +397,8 @@ void SocketSelector::clear()
 
     m_impl->maxSocket   = 0;
     m_impl->socketCount = 0;
+    m_impl->sockets.clear();
+    m_impl->readySockets.clear();
 }
 
 
@@ -175,14 +410,46 @@ bool SocketSelector::wait(Time timeout)
     time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
     time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1000000);
 
+    // Sockets that have data buffered on their side are ready, whatever the system says,
+    // so don't wait at all if there are some
+    m_impl->bufferedHandles.clear();
+    priv::BufferedSocketSet::forEach(
+        [this](SocketHandle handle)
+        {
+            if (m_impl->sockets.find(handle) != m_impl->sockets.end())
+                m_impl->bufferedHandles.push_back(handle);
+        });
+
+    const bool hasBufferedData = !m_impl->bufferedHandles.empty();
+    if (hasBufferedData)
+        time = timeval{};
+
     // Initialize the set that will contain the sockets that are ready
     m_impl->socketsReady = m_impl->allSockets;
 
     // Wait until one of the sockets is ready for reading, or timeout is reached
     // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
+    const int count = select(m_impl->maxSocket + 1,
+                             &m_impl->socketsReady,
+                             nullptr,
+                             nullptr,
+                             (timeout != Time::Zero) || hasBufferedData ? &time : nullptr);
+
+    // Collect the sockets that are ready
+    if (count < 0)
+        FD_ZERO(&m_impl->socketsReady);
+
+    for (const SocketHandle handle : m_impl->bufferedHandles)
+        FD_SET(handle, &m_impl->socketsReady);
+
+    m_impl->readySockets.clear();
+    for (const auto& [handle, socket] : m_impl->sockets)
+    {
+        if (FD_ISSET(handle, &m_impl->socketsReady))
+            m_impl->readySockets.push_back(socket);
+    }
 
-    return count > 0;
+    return !m_impl->readySockets.empty();
 }
 
 
@@ -206,4 +473,13 @@ bool SocketSelector::isReady(Socket& socket) const
     return false;
 }
 
+#endif
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Socket*>& SocketSelector::getReadySockets() const
+{
+    return m_impl->readySockets;
+}
+
 } // namespace sf
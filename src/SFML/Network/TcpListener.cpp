@@ -123,7 +123,7 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
         return priv::SocketImpl::getErrorStatus();
 
     // Initialize the new connected socket
-    socket.close();
+    socket.disconnect();
     socket.create(remote);
 
     return Status::Done;
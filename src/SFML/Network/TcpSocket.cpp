@@ -51,6 +51,66 @@ const int flags = MSG_NOSIGNAL;
 #else
 const int flags = 0;
 #endif
+
+// Size of the buffer receiving the data ahead of the packets
+constexpr std::size_t receiveBufferSize = 65536;
+
+// Largest packet size reserved up front, the size comes from the peer so bigger packets grow as their data arrives
+constexpr std::size_t maxReservedPacket = 64 * 1024;
+
+// Consume the given number of bytes at the start of a list of buffers, return the index of the first buffer left
+std::size_t skipBytes(sf::priv::SocketImpl::Buffer* buffers, std::size_t count, std::size_t bytes)
+{
+    std::size_t first = 0;
+    while ((first < count) && (bytes >= buffers[first].size))
+    {
+        bytes -= buffers[first].size;
+        buffers[first].size = 0;
+        ++first;
+    }
+
+    if (bytes > 0)
+    {
+        buffers[first].data += bytes;
+        buffers[first].size -= bytes;
+    }
+
+    return first;
+}
+
+// Send a list of buffers as if they were contiguous, with as few system calls as possible
+// (the buffers are modified to keep track of what remains to be sent)
+sf::Socket::Status sendBuffers(sf::SocketHandle              handle,
+                               sf::priv::SocketImpl::Buffer* buffers,
+                               std::size_t                   count,
+                               std::size_t&                  sent)
+{
+    sent = 0;
+
+    // Loop until every byte has been sent
+    std::size_t first = skipBytes(buffers, count, 0);
+    while (first < count)
+    {
+        // Send a chunk of data
+        const std::int64_t result = sf::priv::SocketImpl::sendBuffers(handle, buffers + first, count - first, flags);
+
+        // Check for errors
+        if (result < 0)
+        {
+            const sf::Socket::Status status = sf::priv::SocketImpl::getErrorStatus();
+
+            if ((status == sf::Socket::Status::NotReady) && sent)
+                return sf::Socket::Status::Partial;
+
+            return status;
+        }
+
+        sent += static_cast<std::size_t>(result);
+        first += skipBytes(buffers + first, count - first, static_cast<std::size_t>(result));
+    }
+
+    return sf::Socket::Status::Done;
+}
 } // namespace
 
 namespace sf
@@ -216,7 +276,12 @@ void TcpSocket::disconnect()
     close();
 
     // Reset the pending packet data
-    m_pendingPacket = PendingPacket();
+    m_pendingPacket.sizeReceived = 0;
+    m_pendingPacket.data.clear();
+
+    // Drop the data received ahead, it belonged to the previous connection
+    m_receiveBuffer.begin = 0;
+    m_receiveBuffer.end   = 0;
 }
 
 
@@ -284,6 +349,15 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         return Status::Error;
     }
 
+    // Hand out the data already received ahead, if any
+    if (hasBufferedData())
+    {
+        received = std::min(size, m_receiveBuffer.end - m_receiveBuffer.begin);
+        std::memcpy(data, m_receiveBuffer.data.data() + m_receiveBuffer.begin, received);
+        consumeReceiveBuffer(received);
+        return Status::Done;
+    }
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
     // Receive a chunk of bytes
@@ -313,43 +387,25 @@ Socket::Status TcpSocket::send(Packet& packet)
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+    // The size and the data are sent together with a single scatter-gather call,
+    // without copying them into a contiguous block first. Sending them in
+    // separate calls could cause a partial send, which would corrupt the data
+    // on the receiving end.
 
     // Get the data to send from the packet
     std::size_t size = 0;
     const void* data = packet.onSend(size);
 
     // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    const std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
-
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+    // Send the packet size and data, skipping what a previous partial send already sent
+    std::array<priv::SocketImpl::Buffer, 2> buffers{
+        {{reinterpret_cast<const std::byte*>(&packetSize), sizeof(packetSize)}, {static_cast<const std::byte*>(data), size}}};
+    skipBytes(buffers.data(), buffers.size(), packet.m_sendPos);
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
     std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+    const Status status = sendBuffers(getNativeHandle(), buffers.data(), buffers.size(), sent);
 
     // In the case of a partial send, record the location to resume from
     if (status == Status::Partial)
@@ -365,6 +421,64 @@ Socket::Status TcpSocket::send(Packet& packet)
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(const std::vector<Packet*>& packets)
+{
+    // Each packet is sent as its size followed by its data, like with `send(Packet&)`
+    std::vector<std::uint32_t>            packetSizes(packets.size());
+    std::vector<std::size_t>              blockSizes(packets.size());
+    std::vector<priv::SocketImpl::Buffer> buffers;
+    buffers.reserve(packets.size() * 2);
+
+    for (std::size_t i = 0; i < packets.size(); ++i)
+    {
+        Packet& packet = *packets[i];
+
+        std::size_t size = 0;
+        const void* data = packet.onSend(size);
+        packetSizes[i]   = htonl(static_cast<std::uint32_t>(size));
+        blockSizes[i]    = sizeof(packetSizes[i]) + size;
+
+        // Packets already sent by a previous partial send are skipped, the
+        // packet that was being sent resumes from where it stopped
+        std::array<priv::SocketImpl::Buffer, 2> packetBuffers{
+            {{reinterpret_cast<const std::byte*>(&packetSizes[i]), sizeof(packetSizes[i])},
+             {static_cast<const std::byte*>(data), size}}};
+        const std::size_t first = skipBytes(packetBuffers.data(), packetBuffers.size(), packet.m_sendPos);
+        buffers.insert(buffers.end(), packetBuffers.begin() + static_cast<std::ptrdiff_t>(first), packetBuffers.end());
+    }
+
+    if (buffers.empty())
+    {
+        err() << "Cannot send data over the network (no data to send)" << std::endl;
+        return Status::Error;
+    }
+
+    std::size_t  sent   = 0;
+    const Status status = sendBuffers(getNativeHandle(), buffers.data(), buffers.size(), sent);
+
+    if (status == Status::Partial)
+    {
+        // Record the location to resume from in each packet
+        for (std::size_t i = 0; (i < packets.size()) && (sent > 0); ++i)
+        {
+            std::size_t&      sendPos   = packets[i]->m_sendPos;
+            const std::size_t remaining = blockSizes[i] - std::min(sendPos, blockSizes[i]);
+            const std::size_t progress  = std::min(sent, remaining);
+            sendPos += progress;
+            sent -= progress;
+        }
+    }
+    else if (status == Status::Done)
+    {
+        for (Packet* packet : packets)
+            packet->m_sendPos = 0;
+    }
+
+    return status;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(Packet& packet)
 {
@@ -372,58 +486,103 @@ Socket::Status TcpSocket::receive(Packet& packet)
     packet.clear();
 
     // We start by getting the size of the incoming packet
-    std::uint32_t packetSize = 0;
-    std::size_t   received   = 0;
-    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+    // (even a 4 byte variable may be received in more than one call)
+    while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
     {
-        // Loop until we've received the entire size of the packet
-        // (even a 4 byte variable may be received in more than one call)
-        while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+        if (!hasBufferedData())
         {
-            char*        data   = reinterpret_cast<char*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived;
-            const Status status = receive(data, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived, received);
-            m_pendingPacket.sizeReceived += received;
-
+            const Status status = fillReceiveBuffer();
             if (status != Status::Done)
                 return status;
         }
 
-        // The packet size has been fully received
-        packetSize = ntohl(m_pendingPacket.size);
+        const std::size_t count = std::min(sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived,
+                                           m_receiveBuffer.end - m_receiveBuffer.begin);
+        std::memcpy(reinterpret_cast<std::byte*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived,
+                    m_receiveBuffer.data.data() + m_receiveBuffer.begin,
+                    count);
+        m_pendingPacket.sizeReceived += count;
+        consumeReceiveBuffer(count);
     }
-    else
+
+    const std::size_t packetSize = ntohl(m_pendingPacket.size);
+
+    // If the whole packet was received ahead, hand it out straight from the read-ahead buffer
+    if (m_pendingPacket.data.empty() && (m_receiveBuffer.end - m_receiveBuffer.begin >= packetSize))
     {
-        // The packet size has already been received in a previous call
-        packetSize = ntohl(m_pendingPacket.size);
+        if (packetSize > 0)
+            packet.onReceive(m_receiveBuffer.data.data() + m_receiveBuffer.begin, packetSize);
+
+        consumeReceiveBuffer(packetSize);
+        m_pendingPacket.sizeReceived = 0;
+        return Status::Done;
     }
 
+    // Otherwise gather the packet data, without trusting the announced size for the allocation
+    m_pendingPacket.data.reserve(std::min(packetSize, maxReservedPacket));
+
     // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
     while (m_pendingPacket.data.size() < packetSize)
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), sizeof(buffer));
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
-        if (status != Status::Done)
-            return status;
-
-        // Append it into the packet
-        if (received > 0)
+        if (!hasBufferedData())
         {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
+            const Status status = fillReceiveBuffer();
+            if (status != Status::Done)
+                return status;
         }
+
+        // Take what we can from the data received ahead
+        const std::size_t count = std::min(packetSize - m_pendingPacket.data.size(),
+                                           m_receiveBuffer.end - m_receiveBuffer.begin);
+        const auto        begin = m_receiveBuffer.data.begin() + static_cast<std::ptrdiff_t>(m_receiveBuffer.begin);
+        m_pendingPacket.data.insert(m_pendingPacket.data.end(), begin, begin + static_cast<std::ptrdiff_t>(count));
+        consumeReceiveBuffer(count);
     }
 
     // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
-        packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
+    packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
 
-    // Clear the pending packet data
-    m_pendingPacket = PendingPacket();
+    // Clear the pending packet data, keeping its storage for the next packets
+    // unless a large packet made it grow, so that it doesn't stay allocated
+    m_pendingPacket.sizeReceived = 0;
+    if (m_pendingPacket.data.capacity() > maxReservedPacket)
+        std::vector<std::byte>().swap(m_pendingPacket.data);
+    else
+        m_pendingPacket.data.clear();
 
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::hasBufferedData() const
+{
+    return m_receiveBuffer.begin < m_receiveBuffer.end;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::consumeReceiveBuffer(std::size_t count)
+{
+    m_receiveBuffer.begin += count;
+
+    if (!hasBufferedData())
+        setHasBufferedData(false);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::fillReceiveBuffer()
+{
+    // The buffer is only refilled once it has been fully consumed,
+    // so the new data can always be stored from its beginning
+    m_receiveBuffer.begin = 0;
+    m_receiveBuffer.end   = 0;
+    m_receiveBuffer.data.resize(receiveBufferSize);
+
+    const Status status = receive(m_receiveBuffer.data.data(), m_receiveBuffer.data.size(), m_receiveBuffer.end);
+    setHasBufferedData(hasBufferedData());
+    return status;
+}
+
 } // namespace sf
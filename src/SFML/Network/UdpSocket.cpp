@@ -32,10 +32,25 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cstddef>
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_UDP_SOCKET_MMSG
+#endif
+
+
+namespace
+{
+// Maximum number of datagrams sent or received by a single system call
+// (each received datagram needs its own buffer of sf::UdpSocket::MaxDatagramSize bytes)
+constexpr std::size_t sendBatchSize    = 64;
+constexpr std::size_t receiveBatchSize = 32;
+} // namespace
+
 
 namespace sf
 {
@@ -220,4 +235,203 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const std::vector<Datagram>& datagrams, std::size_t& sent)
+{
+    sent = 0;
+
+    // Create the internal socket if it doesn't exist
+    create();
+
+    // Check all the datagrams first, so that nothing is sent if one of them is invalid
+    for (const Datagram& datagram : datagrams)
+    {
+        if (!datagram.packet || !datagram.remoteAddress.has_value())
+        {
+            err() << "Cannot send data over the network (a datagram has no packet or no receiver)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+#ifdef SFML_UDP_SOCKET_MMSG
+
+    std::array<mmsghdr, sendBatchSize>     messages{};
+    std::array<iovec, sendBatchSize>       buffers{};
+    std::array<sockaddr_in, sendBatchSize> addresses{};
+
+    while (sent < datagrams.size())
+    {
+        // Prepare the next batch of datagrams, up to the first one that is too big
+        const std::size_t maxCount = std::min(datagrams.size() - sent, sendBatchSize);
+        std::size_t       count    = 0;
+        bool              tooBig   = false;
+        for (; count < maxCount; ++count)
+        {
+            const Datagram& datagram = datagrams[sent + count];
+
+            std::size_t size = 0;
+            const void* data = datagram.packet->onSend(size);
+            if (size > MaxDatagramSize)
+            {
+                tooBig = true;
+                break;
+            }
+
+            buffers[count].iov_base = const_cast<void*>(data);
+            buffers[count].iov_len  = size;
+
+            addresses[count] = priv::SocketImpl::createAddress(datagram.remoteAddress->toInteger(),
+                                                               datagram.remotePort);
+
+            messages[count]                     = mmsghdr{};
+            messages[count].msg_hdr.msg_name    = &addresses[count];
+            messages[count].msg_hdr.msg_namelen = sizeof(addresses[count]);
+            messages[count].msg_hdr.msg_iov     = &buffers[count];
+            messages[count].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Send the whole batch at once
+        if (count > 0)
+        {
+            const int result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(count), 0);
+            if (result < 0)
+            {
+                const Status status = priv::SocketImpl::getErrorStatus();
+                return (sent > 0) && (status == Status::NotReady) ? Status::Partial : status;
+            }
+
+            sent += static_cast<std::size_t>(result);
+
+            // The datagrams that didn't fit are sent with the next batch
+            if (static_cast<std::size_t>(result) < count)
+                continue;
+        }
+
+        if (tooBig)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+#else
+
+    // Fall back to one system call per datagram
+    for (const Datagram& datagram : datagrams)
+    {
+        std::size_t  size   = 0;
+        const void*  data   = datagram.packet->onSend(size);
+        const Status status = send(data, size, *datagram.remoteAddress, datagram.remotePort);
+        if (status != Status::Done)
+            return (sent > 0) && (status == Status::NotReady) ? Status::Partial : status;
+
+        ++sent;
+    }
+
+#endif
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(std::vector<Datagram>& datagrams, std::size_t& received)
+{
+    received = 0;
+
+    for (const Datagram& datagram : datagrams)
+    {
+        if (!datagram.packet)
+        {
+            err() << "Cannot receive data from the network (a datagram has no packet to fill)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    if (datagrams.empty())
+        return Status::Done;
+
+#ifdef SFML_UDP_SOCKET_MMSG
+
+    // Every datagram of a batch gets its own part of the buffer
+    m_buffer.resize(std::max(m_buffer.size(), receiveBatchSize * MaxDatagramSize));
+
+    std::array<mmsghdr, receiveBatchSize>     messages{};
+    std::array<iovec, receiveBatchSize>       buffers{};
+    std::array<sockaddr_in, receiveBatchSize> addresses{};
+
+    while (received < datagrams.size())
+    {
+        const std::size_t count = std::min(datagrams.size() - received, receiveBatchSize);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            buffers[i].iov_base = m_buffer.data() + i * MaxDatagramSize;
+            buffers[i].iov_len  = MaxDatagramSize;
+
+            messages[i]                     = mmsghdr{};
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Only the first system call may wait (in blocking mode), and only for the first datagram
+        const int flags  = received == 0 ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int result = recvmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(count), flags, nullptr);
+        if (result < 0)
+        {
+            if (received > 0)
+                break;
+
+            return priv::SocketImpl::getErrorStatus();
+        }
+
+        // Copy the received data to the user packets
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            Datagram& datagram     = datagrams[received + i];
+            datagram.remoteAddress = IpAddress(ntohl(addresses[i].sin_addr.s_addr));
+            datagram.remotePort    = ntohs(addresses[i].sin_port);
+
+            datagram.packet->clear();
+            if (messages[i].msg_len > 0)
+                datagram.packet->onReceive(buffers[i].iov_base, messages[i].msg_len);
+        }
+
+        received += static_cast<std::size_t>(result);
+
+        // Stop once the queue of the socket is empty
+        if (static_cast<std::size_t>(result) < count)
+            break;
+    }
+
+#else
+
+    // Fall back to one system call per datagram; only the first one may wait
+    const bool blocking = isBlocking();
+    Status     status   = Status::Done;
+    while (received < datagrams.size())
+    {
+        Datagram& datagram = datagrams[received];
+        status             = receive(*datagram.packet, datagram.remoteAddress, datagram.remotePort);
+        if (status != Status::Done)
+            break;
+
+        if ((received++ == 0) && blocking)
+            setBlocking(false);
+    }
+
+    if ((received > 0) && blocking)
+        setBlocking(true);
+
+    if (received == 0)
+        return status;
+
+#endif
+
+    return Status::Done;
+}
+
+
 } // namespace sf
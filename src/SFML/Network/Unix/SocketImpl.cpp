@@ -29,6 +29,8 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <fcntl.h>
 #include <ostream>
 
@@ -84,6 +86,26 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    // 256 is far below the IOV_MAX of the systems we support, and keeps the vectors on the stack
+    std::array<iovec, 256> vectors{};
+    const std::size_t      vectorCount = std::min(count, vectors.size());
+    for (std::size_t i = 0; i < vectorCount; ++i)
+    {
+        vectors[i].iov_base = const_cast<std::byte*>(buffers[i].data);
+        vectors[i].iov_len  = buffers[i].size;
+    }
+
+    msghdr message{};
+    message.msg_iov    = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(vectorCount);
+
+    return static_cast<std::int64_t>(sendmsg(sock, &message, flags));
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -27,6 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include <cstdint>
 
 
@@ -66,6 +69,25 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    std::array<WSABUF, 256> wsaBuffers{};
+    const std::size_t       bufferCount = std::min(count, wsaBuffers.size());
+    for (std::size_t i = 0; i < bufferCount; ++i)
+    {
+        wsaBuffers[i].buf = reinterpret_cast<CHAR*>(const_cast<std::byte*>(buffers[i].data));
+        wsaBuffers[i].len = static_cast<ULONG>(buffers[i].size);
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock, wsaBuffers.data(), static_cast<DWORD>(bufferCount), &sent, static_cast<DWORD>(flags), nullptr, nullptr) != 0)
+        return -1;
+
+    return static_cast<std::int64_t>(sent);
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/ThreadPool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned int threadCount, Shutdown shutdown) : m_shutdown(shutdown)
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_threads.emplace_back(&ThreadPool::run, this);
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    // Abandoned tasks are destroyed outside of the lock, their futures may be waited for by other threads
+    std::deque<std::packaged_task<void()>> abandonedTasks;
+
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stop = true;
+
+        if (m_shutdown == Shutdown::AbandonPendingTasks)
+            abandonedTasks.swap(m_tasks);
+    }
+
+    m_condition.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::enqueue(std::packaged_task<void()> task)
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    m_condition.notify_one();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ThreadPool::getThreadCount() const
+{
+    return static_cast<unsigned int>(m_threads.size());
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool& ThreadPool::getShared()
+{
+    // The program doesn't wait at exit for work that nobody will ever look at
+    static ThreadPool pool(0, Shutdown::AbandonPendingTasks);
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::run()
+{
+    for (;;)
+    {
+        std::packaged_task<void()> task;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+
+            // Finish the queued tasks before leaving, so that every future gets its result
+            if (m_tasks.empty())
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace sf::priv
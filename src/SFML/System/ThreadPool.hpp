@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of threads running tasks in the background
+///
+/// Tasks are run in the order they were queued, by the first
+/// thread available. The pool is used by the modules that
+/// load resources in the background, either through their
+/// own instance or through the shared one.
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ThreadPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief What happens to the queued tasks when the pool is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Shutdown
+    {
+        RunPendingTasks,    //!< Run the queued tasks before stopping the threads
+        AbandonPendingTasks //!< Drop the tasks that didn't start, their futures report a broken promise
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the pool and start its threads
+    ///
+    /// \param threadCount Number of threads, 0 for one per hardware thread
+    /// \param shutdown    What to do with the queued tasks on destruction
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ThreadPool(unsigned int threadCount = 0, Shutdown shutdown = Shutdown::RunPendingTasks);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the threads once the running tasks are done
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool(const ThreadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a task
+    ///
+    /// \param task Task to run on one of the threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void enqueue(std::packaged_task<void()> task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads of the pool
+    ///
+    /// \return Number of threads running the tasks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pool shared by the whole program
+    ///
+    /// It has one thread per hardware thread, is created on
+    /// first use, and abandons the tasks that didn't start
+    /// when the program exits. Tasks that use static objects
+    /// must make sure that these objects outlive the pool.
+    ///
+    /// \return Shared thread pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ThreadPool& getShared();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the queued tasks until the pool is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                             m_mutex;     //!< Protects the task queue
+    std::condition_variable                m_condition; //!< Signaled when a task is queued or the pool stops
+    std::deque<std::packaged_task<void()>> m_tasks;     //!< Tasks waiting for a thread
+    Shutdown                               m_shutdown;  //!< What to do with the queued tasks on destruction
+    bool                                   m_stop{};    //!< Should the threads exit once the queue is empty?
+    std::vector<std::thread>               m_threads;   //!< Threads running the tasks
+};
+
+} // namespace sf::priv
@@ -1,16 +1,24 @@
 #include <SFML/Audio/InputSoundFile.hpp>
 
 // Other 1st party headers
+#include <SFML/Audio/OutputSoundFile.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <filesystem>
 #include <fstream>
 #include <type_traits>
+#include <vector>
+
+#include <cmath>
 
 TEST_CASE("[Audio] sf::InputSoundFile")
 {
@@ -382,6 +390,81 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         }
     }
 
+    SECTION("readFloat()")
+    {
+        sf::InputSoundFile inputSoundFile("Audio/ding.flac");
+
+        SECTION("Null address")
+        {
+            CHECK(inputSoundFile.readFloat(nullptr, 10) == 0);
+        }
+
+        std::array<float, 4> samples{};
+
+        SECTION("Zero count")
+        {
+            CHECK(inputSoundFile.readFloat(samples.data(), 0) == 0);
+        }
+
+        SECTION("Successful read")
+        {
+            const auto toInt16 = [](const std::array<float, 4>& floatSamples)
+            {
+                std::array<long, 4> result{};
+                for (std::size_t i = 0; i < floatSamples.size(); ++i)
+                    result[i] = std::lround(floatSamples[i] * 32768.f);
+                return result;
+            };
+
+            SECTION("flac")
+            {
+                inputSoundFile = sf::InputSoundFile("Audio/ding.flac");
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{0.f, 1.f / 32768.f, -1.f / 32768.f, 4.f / 32768.f});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{1.f / 32768.f, 4.f / 32768.f, 9.f / 32768.f, 6.f / 32768.f});
+                CHECK(inputSoundFile.getSampleOffset() == 8);
+            }
+
+            SECTION("mp3")
+            {
+                inputSoundFile = sf::InputSoundFile("Audio/ding.mp3");
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(toInt16(samples) == std::array<long, 4>{0, -2, 0, 2});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(toInt16(samples) == std::array<long, 4>{1, 4, 6, 8});
+            }
+
+            SECTION("ogg")
+            {
+                inputSoundFile = sf::InputSoundFile("Audio/doodle_pop.ogg");
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(toInt16(samples) == std::array<long, 4>{-827, -985, -1168, -1319});
+                CHECK(inputSoundFile.readFloat(samples.data(), samples.size()) == 4);
+                CHECK(toInt16(samples) == std::array<long, 4>{-1738, -1883, -2358, -2497});
+            }
+        }
+    }
+
+    SECTION("read() in blocks that split FLAC frames")
+    {
+        sf::InputSoundFile        inputSoundFile("Audio/ding.flac");
+        std::vector<std::int16_t> expected(static_cast<std::size_t>(inputSoundFile.getSampleCount()));
+        CHECK(inputSoundFile.read(expected.data(), expected.size()) == expected.size());
+
+        for (const std::size_t blockSize : {1u, 7u, 4095u})
+        {
+            inputSoundFile.seek(0);
+            std::vector<std::int16_t> samples(expected.size());
+            std::size_t               offset = 0;
+            while (const auto count = inputSoundFile.read(samples.data() + offset,
+                                                          std::min(blockSize, samples.size() - offset)))
+                offset += static_cast<std::size_t>(count);
+            CHECK(offset == expected.size());
+            CHECK(samples == expected);
+        }
+    }
+
     SECTION("close()")
     {
         sf::InputSoundFile inputSoundFile("Audio/ding.flac");
@@ -394,3 +477,71 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         CHECK(inputSoundFile.getSampleOffset() == 0);
     }
 }
+
+TEST_CASE("[Audio] sf::InputSoundFile FLAC decoding throughput", "[.benchmark]")
+{
+    // Run with `test-sfml-audio "[.benchmark]"`; not part of the regular test run
+    const auto decodeAll = [](const std::filesystem::path& path, std::size_t blockSize)
+    {
+        sf::InputSoundFile        inputSoundFile(path);
+        std::vector<std::int16_t> samples(blockSize);
+        std::uint64_t             total = 0;
+        while (const auto count = inputSoundFile.read(samples.data(), samples.size()))
+            total += count;
+        return total;
+    };
+
+    const auto decodeAllFloat = [](const std::filesystem::path& path, std::size_t blockSize)
+    {
+        sf::InputSoundFile inputSoundFile(path);
+        std::vector<float> samples(blockSize);
+        std::uint64_t      total = 0;
+        while (const auto count = inputSoundFile.readFloat(samples.data(), samples.size()))
+            total += count;
+        return total;
+    };
+
+    BENCHMARK("ding.flac, 64 sample reads")
+    {
+        return decodeAll("Audio/ding.flac", 64);
+    };
+    BENCHMARK("ding.flac, 65536 sample reads")
+    {
+        return decodeAll("Audio/ding.flac", 65536);
+    };
+
+    // One minute of stereo noise over a tone, so the encoder can't collapse it into constant subframes
+    const auto synthetic = std::filesystem::temp_directory_path() / "sfml-flac-benchmark.flac";
+    {
+        constexpr unsigned int    sampleRate = 44100;
+        std::vector<std::int16_t> samples(std::size_t{sampleRate} * 2 * 60);
+        std::uint32_t             seed = 1;
+        for (std::size_t i = 0; i < samples.size(); ++i)
+        {
+            seed       = seed * 1664525u + 1013904223u;
+            samples[i] = static_cast<std::int16_t>(static_cast<int>((i / 2) % 200) * 100 - 10000 +
+                                                   static_cast<int>(seed >> 22) - 512);
+        }
+
+        sf::OutputSoundFile outputSoundFile(synthetic,
+                                            sampleRate,
+                                            2,
+                                            {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight});
+        outputSoundFile.write(samples.data(), samples.size());
+    }
+
+    BENCHMARK("60 s stereo, 64 sample reads")
+    {
+        return decodeAll(synthetic, 64);
+    };
+    BENCHMARK("60 s stereo, 65536 sample reads")
+    {
+        return decodeAll(synthetic, 65536);
+    };
+    BENCHMARK("60 s stereo, 65536 sample float reads")
+    {
+        return decodeAllFloat(synthetic, 65536);
+    };
+
+    std::filesystem::remove(synthetic);
+}
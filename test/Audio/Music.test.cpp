@@ -1,6 +1,8 @@
 #include <SFML/Audio/Music.hpp>
 
 // Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
@@ -8,8 +10,112 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+using namespace std::chrono_literals;
+
+// Pulls the samples the way sf::SoundStream does, without an audio thread
+class MusicReader : public sf::Music
+{
+public:
+    using sf::Music::Music;
+    using sf::Music::onGetData;
+    using sf::Music::onLoop;
+
+    template <typename T = std::int16_t>
+    [[nodiscard]] std::vector<T> read(std::size_t sampleCount)
+    {
+        std::vector<T> samples;
+
+        while (samples.size() < sampleCount)
+        {
+            const std::uint64_t underrunCount = getUnderrunCount();
+            Chunk               chunk;
+            const bool          more = onGetData(chunk);
+
+            // Skip the silence played while the decoder thread catches up
+            if (getUnderrunCount() != underrunCount)
+            {
+                ++silentChunkCount;
+                std::this_thread::sleep_for(1ms);
+                continue;
+            }
+
+            if constexpr (std::is_same_v<T, float>)
+                samples.insert(samples.end(), chunk.floatSamples, chunk.floatSamples + chunk.sampleCount);
+            else
+                samples.insert(samples.end(), chunk.samples, chunk.samples + chunk.sampleCount);
+
+            if (!more && !(isLooping() && onLoop()))
+                break;
+        }
+
+        samples.resize(std::min(samples.size(), sampleCount));
+        return samples;
+    }
+
+    std::uint64_t silentChunkCount{};
+};
+
+// File stream whose reads wait while it is closed, to hold the decoder thread back
+class GatedStream : public sf::InputStream
+{
+public:
+    explicit GatedStream(const std::filesystem::path& filename) : m_file(filename)
+    {
+    }
+
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override
+    {
+        if (!open)
+        {
+            ++waitingReadCount;
+            while (!open)
+                std::this_thread::sleep_for(1ms);
+        }
+
+        return m_file.read(data, size);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override
+    {
+        return m_file.seek(position);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> tell() override
+    {
+        return m_file.tell();
+    }
+
+    std::optional<std::size_t> getSize() override
+    {
+        return m_file.getSize();
+    }
+
+    std::atomic<bool> open{true};
+    std::atomic<int>  waitingReadCount{};
+
+private:
+    sf::FileInputStream m_file;
+};
+
+[[nodiscard]] std::vector<std::int16_t> readAll(const std::filesystem::path& filename)
+{
+    sf::InputSoundFile        file(filename);
+    std::vector<std::int16_t> samples(static_cast<std::size_t>(file.getSampleCount()));
+    samples.resize(static_cast<std::size_t>(file.read(samples.data(), samples.size())));
+    return samples;
+}
+} // namespace
 
 TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
 {
@@ -47,6 +153,8 @@ TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
             CHECK(music.getStatus() == sf::Music::Status::Stopped);
             CHECK(music.getPlayingOffset() == sf::Time::Zero);
             CHECK(!music.isLooping());
+            CHECK(music.getDecodeAhead() == sf::Time::Zero);
+            CHECK(music.getUnderrunCount() == 0);
         }
 
         SECTION("File")
@@ -252,4 +360,151 @@ TEST_CASE("[Audio] sf::Music", runAudioDeviceTests())
         CHECK(music.getPlayingOffset() == sf::Time::Zero);
         CHECK(!music.isLooping());
     }
+
+    SECTION("setDecodeAhead()")
+    {
+        sf::Music music("Audio/killdeer.wav");
+        music.setDecodeAhead(sf::seconds(2));
+        CHECK(music.getDecodeAhead() == sf::seconds(2));
+        CHECK(music.getStatus() == sf::Music::Status::Stopped);
+        CHECK(music.getPlayingOffset() == sf::Time::Zero);
+
+        // Playback starts right away, the decoder thread keeps filling the ring in the background
+        music.play();
+        CHECK(music.getStatus() == sf::Music::Status::Playing);
+
+        music.setDecodeAhead(sf::Time::Zero);
+        CHECK(music.getDecodeAhead() == sf::Time::Zero);
+        CHECK(music.getStatus() == sf::Music::Status::Playing);
+
+        music.stop();
+        CHECK(music.getStatus() == sf::Music::Status::Stopped);
+    }
+
+    SECTION("Decoding ahead")
+    {
+        const auto reference = readAll("Audio/killdeer.wav");
+        REQUIRE(reference.size() == 112'941);
+
+        SECTION("Same samples as direct decoding")
+        {
+            MusicReader direct("Audio/killdeer.wav");
+            MusicReader ahead("Audio/killdeer.wav");
+            ahead.setDecodeAhead(sf::milliseconds(500));
+
+            const auto directSamples = direct.read(reference.size() * 2);
+            CHECK(directSamples == reference);
+            CHECK(ahead.read(reference.size() * 2) == directSamples);
+        }
+
+        SECTION("Float samples")
+        {
+            sf::InputSoundFile floatFile("Audio/killdeer.wav");
+            std::vector<float> floatReference(static_cast<std::size_t>(floatFile.getSampleCount()));
+            floatReference.resize(
+                static_cast<std::size_t>(floatFile.readFloat(floatReference.data(), floatReference.size())));
+            REQUIRE(floatReference.size() == reference.size());
+
+            MusicReader direct("Audio/killdeer.wav", sf::SampleFormat::Float32);
+            MusicReader ahead("Audio/killdeer.wav", sf::SampleFormat::Float32);
+            ahead.setDecodeAhead(sf::milliseconds(500));
+            CHECK(direct.getSampleFormat() == sf::SampleFormat::Float32);
+
+            CHECK(direct.read<float>(floatReference.size() * 2) == floatReference);
+            CHECK(ahead.read<float>(floatReference.size() * 2) == floatReference);
+        }
+
+        SECTION("Loop points")
+        {
+            // The file plays up to the loop end, then the loop repeats
+            std::vector<std::int16_t> expected(reference.begin(), reference.begin() + 6615);
+            for (int i = 0; i < 3; ++i)
+                expected.insert(expected.end(), reference.begin() + 4410, reference.begin() + 6615);
+
+            for (const sf::Time decodeAhead : {sf::Time::Zero, sf::milliseconds(500)})
+            {
+                MusicReader music("Audio/killdeer.wav");
+                music.setDecodeAhead(decodeAhead);
+
+                // Let the decoder thread go past other loop points first
+                music.setLoopPoints({sf::milliseconds(50), sf::milliseconds(50)});
+                std::this_thread::sleep_for(50ms);
+                music.setLoopPoints({sf::milliseconds(200), sf::milliseconds(100)});
+                music.setLooping(true);
+                CHECK(music.read(expected.size()) == expected);
+            }
+        }
+
+        SECTION("Underruns")
+        {
+            GatedStream stream("Audio/killdeer.wav");
+            MusicReader music(stream);
+            CHECK(music.read(reference.size()) == reference);
+            CHECK(music.getUnderrunCount() == 0);
+
+            // Hold the decoder thread back in its first read
+            stream.open = false;
+            music.setDecodeAhead(sf::milliseconds(500));
+            while (stream.waitingReadCount == 0)
+                std::this_thread::sleep_for(1ms);
+
+            // Every chunk requested meanwhile is silence, and counted as an underrun
+            for (int i = 0; i < 3; ++i)
+            {
+                sf::SoundStream::Chunk chunk;
+                CHECK(music.onGetData(chunk));
+                CHECK(chunk.sampleCount > 0);
+                CHECK(std::all_of(chunk.samples,
+                                  chunk.samples + chunk.sampleCount,
+                                  [](std::int16_t sample) { return sample == 0; }));
+            }
+
+            CHECK(music.getUnderrunCount() == 3);
+
+            // Nothing is lost once the decoder thread can read again
+            stream.open = true;
+            CHECK(music.read(reference.size()) == reference);
+            CHECK(music.getUnderrunCount() == 3 + music.silentChunkCount);
+        }
+
+        SECTION("Loop while the decoder thread holds the mutex")
+        {
+            GatedStream stream("Audio/killdeer.wav");
+            MusicReader music(stream);
+            music.setLoopPoints({sf::milliseconds(200), sf::milliseconds(100)});
+            music.setDecodeAhead(sf::milliseconds(500));
+
+            // Let the decoder thread fill the ring past the loop end without looping, then enable looping
+            std::this_thread::sleep_for(50ms);
+            stream.open = false;
+            music.setLooping(true);
+
+            // Reaching the loop end releases the first chunk, the decoder thread then waits in a read with the mutex locked
+            std::vector<std::int16_t> samples;
+            sf::SoundStream::Chunk    chunk;
+            CHECK(music.onGetData(chunk));
+            samples.insert(samples.end(), chunk.samples, chunk.samples + chunk.sampleCount);
+            CHECK(!music.onGetData(chunk));
+            samples.insert(samples.end(), chunk.samples, chunk.samples + chunk.sampleCount);
+            CHECK(samples == std::vector<std::int16_t>(reference.begin(), reference.begin() + 6615));
+            while (stream.waitingReadCount == 0)
+                std::this_thread::sleep_for(1ms);
+
+            // The loop doesn't wait for the mutex, silence is played until the seek is done
+            CHECK(music.onLoop() == 4410);
+            CHECK(music.onGetData(chunk));
+            CHECK(std::all_of(chunk.samples,
+                              chunk.samples + chunk.sampleCount,
+                              [](std::int16_t sample) { return sample == 0; }));
+            CHECK(music.getUnderrunCount() == 1);
+
+            // The loop plays once the decoder thread lets go of the mutex
+            std::vector<std::int16_t> expected;
+            for (int i = 0; i < 3; ++i)
+                expected.insert(expected.end(), reference.begin() + 4410, reference.begin() + 6615);
+
+            stream.open = true;
+            CHECK(music.read(expected.size()) == expected);
+        }
+    }
 }
@@ -1,6 +1,8 @@
 #include <SFML/Audio/SoundBuffer.hpp>
 
 // Other 1st party headers
+#include <SFML/Audio/OutputSoundFile.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
@@ -8,8 +10,14 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <filesystem>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstdlib>
 
 TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
 {
@@ -18,9 +26,9 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         STATIC_CHECK(std::is_copy_constructible_v<sf::SoundBuffer>);
         STATIC_CHECK(std::is_copy_assignable_v<sf::SoundBuffer>);
         STATIC_CHECK(std::is_move_constructible_v<sf::SoundBuffer>);
-        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SoundBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SoundBuffer>);
         STATIC_CHECK(std::is_move_assignable_v<sf::SoundBuffer>);
-        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SoundBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SoundBuffer>);
     }
 
     SECTION("Construction")
@@ -29,6 +37,8 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         {
             const sf::SoundBuffer soundBuffer;
             CHECK(soundBuffer.getSamples() == nullptr);
+            CHECK(soundBuffer.getFloatSamples() == nullptr);
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
             CHECK(soundBuffer.getSampleCount() == 0);
             CHECK(soundBuffer.getSampleRate() == 44100);
             CHECK(soundBuffer.getChannelCount() == 1);
@@ -111,6 +121,106 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         }
     }
 
+    SECTION("Move semantics")
+    {
+        SECTION("Construction")
+        {
+            sf::SoundBuffer       movedSoundBuffer("Audio/ding.flac");
+            const sf::SoundBuffer soundBuffer(std::move(movedSoundBuffer));
+            CHECK(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+
+        SECTION("Assignment")
+        {
+            sf::SoundBuffer movedSoundBuffer("Audio/ding.flac");
+            sf::SoundBuffer soundBuffer("Audio/doodle_pop.ogg");
+            soundBuffer = std::move(movedSoundBuffer);
+            CHECK(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
+    SECTION("loadManyAsync()")
+    {
+        SECTION("Small files")
+        {
+            auto futures = sf::SoundBuffer::loadManyAsync({"Audio/ding.flac", "does/not/exist.wav", "Audio/ding.mp3"});
+            REQUIRE(futures.size() == 3);
+
+            const sf::SoundBuffer flacBuffer = futures[0].get();
+            CHECK(flacBuffer.getSampleCount() == 87798);
+            CHECK(flacBuffer.getDuration() == sf::microseconds(1990884));
+
+            CHECK_THROWS_AS(futures[1].get(), sf::Exception);
+
+            const sf::SoundBuffer mp3Buffer = futures[2].get();
+            CHECK(mp3Buffer.getSampleCount() == sf::SoundBuffer("Audio/ding.mp3").getSampleCount());
+        }
+
+        SECTION("Large file split into ranges")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "large.wav";
+
+            {
+                std::vector<std::int16_t> samples(std::size_t{1} << 22);
+                for (std::size_t i = 0; i < samples.size(); ++i)
+                    samples[i] = static_cast<std::int16_t>(i * 7);
+
+                sf::OutputSoundFile file(filename,
+                                         44100,
+                                         2,
+                                         {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight});
+                file.write(samples.data(), samples.size());
+            }
+
+            // The reader is chosen from the content of the file, not from its extension
+            const auto renamed = std::filesystem::temp_directory_path() / "large.sound";
+            std::filesystem::copy_file(filename, renamed, std::filesystem::copy_options::overwrite_existing);
+
+            for (const auto format : {sf::SampleFormat::Int16, sf::SampleFormat::Float32})
+            {
+                const sf::SoundBuffer expected(filename, format);
+                for (auto& future : sf::SoundBuffer::loadManyAsync({filename, renamed}, format))
+                {
+                    const sf::SoundBuffer soundBuffer = future.get();
+                    REQUIRE(soundBuffer.getSampleCount() == expected.getSampleCount());
+                    CHECK(soundBuffer.getChannelCount() == 2);
+                    CHECK(soundBuffer.getDuration() == expected.getDuration());
+
+                    if (format == sf::SampleFormat::Float32)
+                        CHECK(std::equal(soundBuffer.getFloatSamples(),
+                                         soundBuffer.getFloatSamples() + soundBuffer.getSampleCount(),
+                                         expected.getFloatSamples()));
+                    else
+                        CHECK(std::equal(soundBuffer.getSamples(),
+                                         soundBuffer.getSamples() + soundBuffer.getSampleCount(),
+                                         expected.getSamples()));
+                }
+            }
+
+            CHECK(std::filesystem::remove(filename));
+            CHECK(std::filesystem::remove(renamed));
+        }
+
+        SECTION("More files than threads")
+        {
+            const std::vector<std::filesystem::path> filenames(4 * std::max(std::thread::hardware_concurrency(), 1u),
+                                                               "Audio/ding.flac");
+
+            auto futures = sf::SoundBuffer::loadManyAsync(filenames);
+            REQUIRE(futures.size() == filenames.size());
+            for (auto& future : futures)
+                CHECK(future.get().getSampleCount() == 87798);
+        }
+    }
+
     SECTION("loadFromFile()")
     {
         sf::SoundBuffer soundBuffer;
@@ -176,6 +286,83 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         }
     }
 
+    SECTION("Float32 sample format")
+    {
+        SECTION("loadFromFile()")
+        {
+            sf::SoundBuffer soundBuffer;
+            REQUIRE(soundBuffer.loadFromFile("Audio/ding.flac", sf::SampleFormat::Float32));
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getFloatSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+
+            const sf::SoundBuffer int16Buffer("Audio/ding.flac");
+            CHECK(soundBuffer.getFloatSamples()[3] == static_cast<float>(int16Buffer.getSamples()[3]) / 32768.f);
+
+            // The 16 bit view of the float samples is within one step of the samples decoded as 16 bit
+            REQUIRE(soundBuffer.getSamples() != nullptr);
+            CHECK(std::equal(soundBuffer.getSamples(),
+                             soundBuffer.getSamples() + soundBuffer.getSampleCount(),
+                             int16Buffer.getSamples(),
+                             [](std::int16_t converted, std::int16_t decoded)
+                             { return std::abs(converted - decoded) <= 1; }));
+        }
+
+        SECTION("loadFromSamples()")
+        {
+            constexpr std::array<float, 4> samples{0.f, 0.5f, -0.5f, 1.f};
+
+            sf::SoundBuffer soundBuffer("Audio/ding.flac");
+            REQUIRE(soundBuffer.loadFromSamples(samples.data(),
+                                                samples.size(),
+                                                2,
+                                                44100,
+                                                {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight}));
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBuffer.getFloatSamples()[1] == 0.5f);
+            CHECK(soundBuffer.getSampleCount() == 4);
+            CHECK(soundBuffer.getChannelCount() == 2);
+
+            // getSamples() converts the float samples on demand
+            REQUIRE(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getSamples()[0] == 0);
+            CHECK(soundBuffer.getSamples()[1] == 16383);
+            CHECK(soundBuffer.getSamples()[2] == -16383);
+            CHECK(soundBuffer.getSamples()[3] == 32767);
+
+            const sf::SoundBuffer soundBufferCopy(soundBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(soundBufferCopy.getSampleFormat() == sf::SampleFormat::Float32);
+            CHECK(soundBufferCopy.getSampleCount() == 4);
+
+            // The converted samples follow the float samples when they change
+            constexpr std::array<float, 2> otherSamples{-1.f, 2.f};
+            REQUIRE(
+                soundBuffer.loadFromSamples(otherSamples.data(), otherSamples.size(), 1, 44100, {sf::SoundChannel::Mono}));
+            CHECK(soundBuffer.getSamples()[0] == -32767);
+            CHECK(soundBuffer.getSamples()[1] == 32767);
+        }
+
+        SECTION("saveToFile()")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "ding_float.flac";
+
+            {
+                const sf::SoundBuffer soundBuffer("Audio/ding.flac", sf::SampleFormat::Float32);
+                REQUIRE(soundBuffer.saveToFile(filename));
+            }
+
+            const sf::SoundBuffer soundBuffer(filename);
+            CHECK(soundBuffer.getSampleFormat() == sf::SampleFormat::Int16);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+
+            CHECK(std::filesystem::remove(filename));
+        }
+    }
+
     SECTION("saveToFile()")
     {
         const auto filename = std::filesystem::temp_directory_path() / "ding.flac";
@@ -1,9 +1,182 @@
 #include <SFML/Audio/SoundRecorder.hpp>
 
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
 
 static_assert(!std::is_constructible_v<sf::SoundRecorder>);
 static_assert(!std::is_copy_constructible_v<sf::SoundRecorder>);
 static_assert(!std::is_copy_assignable_v<sf::SoundRecorder>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::SoundRecorder>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::SoundRecorder>);
+
+namespace
+{
+using namespace std::chrono_literals;
+
+class BlockRecorder : public sf::SoundRecorder
+{
+public:
+    ~BlockRecorder() override
+    {
+        stop();
+    }
+
+    // Only read once the recording is stopped, when the processing thread is joined
+    std::vector<std::size_t>  blockSizes;
+    std::size_t               startCount{};
+    std::size_t               stopCount{};
+    std::size_t               maxBlockCount{};
+    std::chrono::milliseconds processingTime{};
+    std::atomic<bool>         blocked{};
+
+private:
+    [[nodiscard]] bool onStart() override
+    {
+        ++startCount;
+        return true;
+    }
+
+    [[nodiscard]] bool onProcessSamples(const std::int16_t* /* samples */, std::size_t sampleCount) override
+    {
+        blockSizes.push_back(sampleCount);
+        std::this_thread::sleep_for(processingTime);
+
+        while (blocked)
+            std::this_thread::sleep_for(1ms);
+
+        return maxBlockCount == 0 || blockSizes.size() < maxBlockCount;
+    }
+
+    void onStop() override
+    {
+        ++stopCount;
+    }
+};
+
+// All blocks but the last one have exactly the block size, the last one holds what was left when stopping
+void checkBlockSizes(const std::vector<std::size_t>& blockSizes, std::size_t blockSize)
+{
+    REQUIRE(!blockSizes.empty());
+    CHECK(std::all_of(blockSizes.begin(), blockSizes.end() - 1, [&](std::size_t size) { return size == blockSize; }));
+    CHECK(blockSizes.back() > 0);
+    CHECK(blockSizes.back() <= blockSize);
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::SoundRecorder", runAudioDeviceTests())
+{
+    SECTION("Processing block size")
+    {
+        BlockRecorder recorder;
+        CHECK(recorder.getProcessingBlockSize() == 0);
+        CHECK(recorder.getOverflowCount() == 0);
+
+        recorder.setProcessingBlockSize(441);
+        CHECK(recorder.getProcessingBlockSize() == 441);
+    }
+
+    SECTION("Blocks longer than the device period")
+    {
+        BlockRecorder recorder;
+        recorder.setProcessingBlockSize(4410);
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(350ms);
+        recorder.stop();
+
+        CHECK(recorder.blockSizes.size() >= 2);
+        checkBlockSizes(recorder.blockSizes, 4410);
+        CHECK(recorder.getOverflowCount() == 0);
+        CHECK(recorder.startCount == 1);
+        CHECK(recorder.stopCount == 1);
+    }
+
+    SECTION("Processing slower than the device")
+    {
+        // Each block of 256 frames lasts less than 6 ms, but takes 10 ms to process
+        BlockRecorder recorder;
+        recorder.processingTime = 10ms;
+        recorder.setProcessingBlockSize(256);
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(200ms);
+        recorder.stop();
+
+        // The ring holds about one second, so nothing is lost and the backlog is delivered when stopping
+        checkBlockSizes(recorder.blockSizes, 256);
+        CHECK(recorder.blockSizes.size() > 20);
+        CHECK(recorder.getOverflowCount() == 0);
+    }
+
+    SECTION("Ring overflow")
+    {
+        BlockRecorder recorder;
+        recorder.blocked = true;
+        recorder.setProcessingBlockSize(441);
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(1500ms);
+        recorder.blocked = false;
+        recorder.stop();
+
+        CHECK(recorder.getOverflowCount() > 0);
+        checkBlockSizes(recorder.blockSizes, 441);
+
+        // The overflow count is reset by the next recording
+        REQUIRE(recorder.start(44100));
+        CHECK(recorder.getOverflowCount() == 0);
+        recorder.stop();
+    }
+
+    SECTION("Stop and restart")
+    {
+        BlockRecorder recorder;
+        recorder.setProcessingBlockSize(441);
+
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(100ms);
+        recorder.stop();
+        const std::size_t firstBlockCount = recorder.blockSizes.size();
+        CHECK(firstBlockCount > 0);
+
+        // The processing block size can't change while recording
+        REQUIRE(recorder.start(22050));
+        recorder.setProcessingBlockSize(882);
+        CHECK(recorder.getProcessingBlockSize() == 441);
+        std::this_thread::sleep_for(100ms);
+        recorder.stop();
+
+        CHECK(recorder.blockSizes.size() > firstBlockCount);
+        CHECK(recorder.getSampleRate() == 22050);
+        CHECK(recorder.startCount == 2);
+        CHECK(recorder.stopCount == 2);
+    }
+
+    SECTION("Stop from onProcessSamples")
+    {
+        BlockRecorder recorder;
+        recorder.maxBlockCount = 3;
+        recorder.setProcessingBlockSize(441);
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(200ms);
+
+        // The processing thread stopped the device by itself, stop() only joins it
+        recorder.stop();
+        CHECK(recorder.blockSizes.size() == 3);
+        CHECK(recorder.stopCount == 0);
+
+        // A new recording can start
+        recorder.maxBlockCount = 0;
+        REQUIRE(recorder.start(44100));
+        std::this_thread::sleep_for(50ms);
+        recorder.stop();
+        CHECK(recorder.blockSizes.size() > 3);
+    }
+}
@@ -1,13 +1,26 @@
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 namespace
 {
+using namespace std::chrono_literals;
+
 class SoundStream : public sf::SoundStream
 {
     [[nodiscard]] bool onGetData(Chunk& /* data */) override
@@ -19,6 +32,164 @@ class SoundStream : public sf::SoundStream
     {
     }
 };
+
+// Mono stream of a known ramp, handed out in chunks of varying sizes
+class RampStream : public sf::SoundStream
+{
+public:
+    RampStream(unsigned int sampleRate, std::size_t sampleCount, std::vector<std::size_t> chunkSizes, bool persistent) :
+    m_sampleRate(sampleRate),
+    m_sampleCount(sampleCount),
+    m_chunkSizes(std::move(chunkSizes)),
+    m_persistent(persistent)
+    {
+        initialize(1, sampleRate, {sf::SoundChannel::Mono});
+    }
+
+    ~RampStream() override
+    {
+        stop();
+    }
+
+    [[nodiscard]] static std::int16_t getSample(std::size_t index)
+    {
+        // Never 0, so that the ramp can't be mistaken for silence
+        return static_cast<std::int16_t>(index % 20000 + 1);
+    }
+
+private:
+    [[nodiscard]] bool onGetData(Chunk& data) override
+    {
+        const std::size_t count = std::min(m_chunkSizes[m_chunkIndex++ % m_chunkSizes.size()],
+                                           m_sampleCount - m_position);
+
+        // The buffer is overwritten by the next call, which is all that persistent chunks promise
+        m_buffer.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+            m_buffer[i] = getSample(m_position + i);
+
+        data.samples     = m_buffer.data();
+        data.sampleCount = count;
+        data.persistent  = m_persistent;
+        m_position += count;
+
+        return m_position < m_sampleCount;
+    }
+
+    void onSeek(sf::Time timeOffset) override
+    {
+        m_position = static_cast<std::size_t>(timeOffset.asMicroseconds()) * m_sampleRate / 1'000'000;
+    }
+
+    unsigned int              m_sampleRate;
+    std::size_t               m_sampleCount;
+    std::vector<std::size_t>  m_chunkSizes;
+    bool                      m_persistent;
+    std::size_t               m_chunkIndex{};
+    std::size_t               m_position{};
+    std::vector<std::int16_t> m_buffer;
+};
+
+// Collect the first channel of what the stream sends to the audio engine, without the leading silence
+class OutputCapture
+{
+public:
+    // The capture must outlive the source, which calls the effect processor until it is destroyed
+    void attach(sf::SoundSource& source)
+    {
+        source.setSpatializationEnabled(false);
+        source.setEffectProcessor(
+            [this](const float* inputFrames,
+                   unsigned int& inputFrameCount,
+                   float*        outputFrames,
+                   unsigned int& outputFrameCount,
+                   unsigned int  frameChannelCount)
+            {
+                const unsigned int frameCount = std::min(inputFrameCount, outputFrameCount);
+
+                if (inputFrames)
+                {
+                    const std::lock_guard lock(m_mutex);
+
+                    for (unsigned int i = 0; i < frameCount; ++i)
+                    {
+                        const auto sample = static_cast<std::int16_t>(
+                            std::lround(inputFrames[i * frameChannelCount] * 32768.f));
+
+                        if (sample != 0 || !m_samples.empty())
+                            m_samples.push_back(sample);
+                    }
+
+                    std::copy(inputFrames, inputFrames + frameCount * frameChannelCount, outputFrames);
+                }
+                else
+                {
+                    std::fill(outputFrames, outputFrames + frameCount * frameChannelCount, 0.f);
+                }
+
+                inputFrameCount  = frameCount;
+                outputFrameCount = frameCount;
+            });
+    }
+
+    [[nodiscard]] std::vector<std::int16_t> getSamples()
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_samples;
+    }
+
+    [[nodiscard]] bool waitFor(std::size_t sampleCount)
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            if (getSamples().size() >= sampleCount)
+                return true;
+
+            std::this_thread::sleep_for(10ms);
+        }
+
+        return false;
+    }
+
+private:
+    std::mutex                m_mutex;
+    std::vector<std::int16_t> m_samples;
+};
+
+// Count the samples that differ from the ramp: any sample dropped, repeated or corrupted by the stream shows up here
+std::size_t countRampMismatches(const std::vector<std::int16_t>& samples,
+                                std::size_t                      rampLength,
+                                std::size_t                      sampleCount)
+{
+    std::size_t mismatchCount = 0;
+    for (std::size_t i = 0; i < std::min(sampleCount, samples.size()); ++i)
+        mismatchCount += samples[i] != RampStream::getSample(i % rampLength);
+
+    return mismatchCount + sampleCount - std::min(sampleCount, samples.size());
+}
+
+// The engine resamples the sounds to the rate of the device, which isn't exposed,
+// so find the rate at which a stream reaches the engine unchanged
+unsigned int getEngineSampleRate()
+{
+    static const unsigned int engineSampleRate = []
+    {
+        for (const unsigned int sampleRate : {48000u, 44100u, 96000u, 88200u, 192000u, 32000u, 22050u, 16000u})
+        {
+            OutputCapture capture;
+            RampStream    stream(sampleRate, 1000, {1000}, true);
+            capture.attach(stream);
+            stream.play();
+
+            if (capture.waitFor(1000) && countRampMismatches(capture.getSamples(), 1000, 999) == 0)
+                return sampleRate;
+        }
+
+        return 0u;
+    }();
+
+    return engineSampleRate;
+}
 } // namespace
 
 TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
@@ -38,6 +209,8 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         const sf::SoundStream::Chunk chunk;
         CHECK(chunk.samples == nullptr);
         CHECK(chunk.sampleCount == 0);
+        CHECK(!chunk.persistent);
+        CHECK(chunk.floatSamples == nullptr);
     }
 
     SECTION("Construction")
@@ -45,6 +218,7 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         const SoundStream soundStream;
         CHECK(soundStream.getChannelCount() == 0);
         CHECK(soundStream.getSampleRate() == 0);
+        CHECK(soundStream.getSampleFormat() == sf::SampleFormat::Int16);
         CHECK(soundStream.getStatus() == sf::SoundStream::Status::Stopped);
         CHECK(soundStream.getPlayingOffset() == sf::Time::Zero);
         CHECK(!soundStream.isLooping());
@@ -63,4 +237,59 @@ TEST_CASE("[Audio] sf::SoundStream", runAudioDeviceTests())
         soundStream.setLooping(true);
         CHECK(soundStream.isLooping());
     }
+
+    SECTION("Output")
+    {
+        const unsigned int sampleRate = getEngineSampleRate();
+        if (sampleRate == 0)
+            SKIP("The audio device runs at an unusual sample rate");
+
+        // Chunks of odd sizes, that never line up with the requests of the audio engine
+        const std::vector<std::size_t> chunkSizes{1000, 37, 4999, 1};
+        const bool                     persistent = GENERATE(false, true);
+
+        // The resampler of the engine keeps the last frame of a sound that ends, so it never reaches the output
+
+        SECTION("Play once")
+        {
+            OutputCapture capture;
+            RampStream    stream(sampleRate, 22050, chunkSizes, persistent);
+            capture.attach(stream);
+            stream.play();
+
+            // The last chunk is only partially filled
+            REQUIRE(capture.waitFor(22050));
+            std::this_thread::sleep_for(50ms);
+            CHECK(stream.getStatus() == sf::SoundStream::Status::Stopped);
+
+            const auto samples = capture.getSamples();
+            CHECK(countRampMismatches(samples, 22050, 22049) == 0);
+            CHECK(std::all_of(samples.begin() + 22049, samples.end(), [](std::int16_t sample) { return sample == 0; }));
+        }
+
+        SECTION("Chunks larger than the stream")
+        {
+            OutputCapture capture;
+            RampStream    stream(sampleRate, 300, {44100}, persistent);
+            capture.attach(stream);
+            stream.play();
+
+            REQUIRE(capture.waitFor(300));
+            CHECK(countRampMismatches(capture.getSamples(), 300, 299) == 0);
+        }
+
+        SECTION("Looping")
+        {
+            OutputCapture capture;
+            RampStream    stream(sampleRate, 5000, chunkSizes, persistent);
+            capture.attach(stream);
+            stream.setLooping(true);
+            stream.play();
+
+            REQUIRE(capture.waitFor(12500));
+            CHECK(stream.getStatus() == sf::SoundStream::Status::Playing);
+            stream.stop();
+            CHECK(countRampMismatches(capture.getSamples(), 5000, 12500) == 0);
+        }
+    }
 }
@@ -1,17 +1,25 @@
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/FontTextureSize.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/String.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
 #include <fstream>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -53,6 +61,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
                 CHECK(glyph.rsbDelta == 16);
                 CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
                 CHECK(glyph.textureRect == sf::IntRect({2, 5}, {8, 12}));
+                CHECK(glyph.textureIndex == 0);
                 CHECK(font.hasGlyph(0x41));
                 CHECK(font.hasGlyph(0xC0));
                 CHECK(font.getKerning(0x41, 0x42, 12) == -1);
@@ -60,6 +69,7 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
                 CHECK(font.getLineSpacing(24) == 30);
                 CHECK(font.getUnderlinePosition(36) == Approx(2.20312f));
                 CHECK(font.getUnderlineThickness(48) == Approx(1.17188f));
+                CHECK(font.getTextureCount(10) == 1);
                 const auto& texture = font.getTexture(10);
                 CHECK(texture.getSize() == sf::Vector2u(128, 128));
                 CHECK(texture.isSmooth());
@@ -254,4 +264,252 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Glyph packing")
+    {
+        const sf::Font font("Graphics/tuffy.ttf");
+
+        std::vector<sf::Glyph> glyphs;
+        for (std::uint32_t codePoint = 0x21; codePoint < 0x7F; ++codePoint)
+            glyphs.push_back(font.getGlyph(codePoint, 48, codePoint % 2 == 0));
+
+        // Glyphs must never overlap within a texture
+        for (std::size_t i = 0; i < glyphs.size(); ++i)
+            for (std::size_t j = i + 1; j < glyphs.size(); ++j)
+                if (glyphs[i].textureIndex == glyphs[j].textureIndex)
+                    CHECK(!glyphs[i].textureRect.findIntersection(glyphs[j].textureRect).has_value());
+
+        // The texture grows instead of spilling into a new one
+        CHECK(font.getTextureCount(48) == 1);
+        CHECK(font.getTexture(48).getSize().x > 128);
+    }
+
+    SECTION("Growing the texture")
+    {
+        const sf::Font     font("Graphics/tuffy.ttf");
+        const sf::IntRect  firstRect = font.getGlyph(U'A', 64, false).textureRect;
+        const sf::Texture& texture   = font.getTexture(64);
+        const sf::Vector2u firstSize = texture.getSize();
+        const sf::Vector2u center(firstRect.getCenter());
+        const sf::Color    pixel = texture.copyToImage().getPixel(center);
+
+        for (char32_t codePoint = U'B'; codePoint <= U'Z'; ++codePoint)
+            (void)font.getGlyph(codePoint, 64, false);
+
+        // The texture object is the same, and the glyphs loaded before kept their pixels
+        REQUIRE(font.getTextureCount(64) == 1);
+        CHECK(&font.getTexture(64) == &texture);
+        CHECK(texture.getSize().x > firstSize.x);
+        CHECK(font.getGlyph(U'A', 64, false).textureRect == firstRect);
+        CHECK(texture.copyToImage().getPixel(center) == pixel);
+    }
+
+    SECTION("Spilling into a new texture")
+    {
+        // Limit the size of the textures, so that they spill quickly
+        struct MaximumSizeGuard
+        {
+            MaximumSizeGuard()
+            {
+                sf::priv::setFontTextureMaximumSize(256);
+            }
+            ~MaximumSizeGuard()
+            {
+                sf::priv::setFontTextureMaximumSize(0);
+            }
+        } guard;
+
+        const sf::Font     font("Graphics/tuffy.ttf");
+        const sf::IntRect  firstRect = font.getGlyph(U'A', 64, false).textureRect;
+        const sf::Texture& texture   = font.getTexture(64, 0);
+
+        // Fill the first texture until a glyph doesn't fit anymore
+        char32_t codePoint = U'B';
+        while ((font.getTextureCount(64) == 1) && (codePoint < U'z'))
+            (void)font.getGlyph(codePoint++, 64, false);
+
+        REQUIRE(font.getTextureCount(64) == 2);
+        const char32_t spilledCodePoint = codePoint - 1;
+        CHECK(font.getGlyph(spilledCodePoint, 64, false).textureIndex == 1);
+
+        // The first texture only spills once it reached the maximum size, and its glyphs don't move
+        CHECK(texture.getSize() == sf::Vector2u(256, 256));
+        CHECK(&font.getTexture(64, 0) == &texture);
+        CHECK(font.getGlyph(U'A', 64, false).textureIndex == 0);
+        CHECK(font.getGlyph(U'A', 64, false).textureRect == firstRect);
+
+        // Text draws glyphs from both textures
+        sf::RenderTexture renderTexture({256, 128});
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(sf::Text(font, sf::String(U'A') + sf::String(spilledCodePoint), 64));
+        renderTexture.display();
+
+        const sf::Image result   = renderTexture.getTexture().copyToImage();
+        const auto      hasPixel = [&](unsigned int left, unsigned int right)
+        {
+            for (unsigned int y = 0; y < result.getSize().y; ++y)
+                for (unsigned int x = left; x < right; ++x)
+                    if (result.getPixel({x, y}) != sf::Color::Black)
+                        return true;
+            return false;
+        };
+        const auto advance = static_cast<unsigned int>(font.getGlyph(U'A', 64, false).advance);
+        CHECK(hasPixel(0, advance));
+        CHECK(hasPixel(advance, result.getSize().x));
+    }
+
+    SECTION("preloadGlyphs()")
+    {
+        const sf::Font   preloaded("Graphics/tuffy.ttf");
+        const sf::Font   reference("Graphics/tuffy.ttf");
+        const sf::String characters = "The quick brown fox jumps over the lazy dog";
+
+        // Glyphs loaded before must survive the upload of the preloaded ones
+        for (const char32_t codePoint : sf::String("quick"))
+        {
+            (void)preloaded.getGlyph(codePoint, 16, false);
+            (void)reference.getGlyph(codePoint, 16, false);
+        }
+
+        CHECK(preloaded.preloadGlyphs(characters, {16, 48}));
+
+        // Glyphs are placed and rasterized exactly as if they were loaded one by one
+        for (const unsigned int characterSize : {16u, 48u})
+        {
+            for (const char32_t codePoint : characters)
+                (void)reference.getGlyph(codePoint, characterSize, false);
+
+            REQUIRE(preloaded.getTextureCount(characterSize) == reference.getTextureCount(characterSize));
+            std::vector<sf::Image> preloadedImages;
+            std::vector<sf::Image> referenceImages;
+            for (std::size_t i = 0; i < preloaded.getTextureCount(characterSize); ++i)
+            {
+                preloadedImages.push_back(preloaded.getTexture(characterSize, i).copyToImage());
+                referenceImages.push_back(reference.getTexture(characterSize, i).copyToImage());
+            }
+
+            for (const char32_t codePoint : characters)
+            {
+                const sf::Glyph& glyph = preloaded.getGlyph(codePoint, characterSize, false);
+                CHECK(glyph.textureRect == reference.getGlyph(codePoint, characterSize, false).textureRect);
+                CHECK(glyph.textureIndex == reference.getGlyph(codePoint, characterSize, false).textureIndex);
+
+                const sf::IntRect rect           = glyph.textureRect;
+                const sf::Image&  preloadedImage = preloadedImages[glyph.textureIndex];
+                const sf::Image&  referenceImage = referenceImages[glyph.textureIndex];
+                bool              samePixels     = true;
+                for (int y = rect.position.y; y < rect.position.y + rect.size.y; ++y)
+                    for (int x = rect.position.x; x < rect.position.x + rect.size.x; ++x)
+                        if (preloadedImage.getPixel(sf::Vector2u(sf::Vector2i(x, y))) !=
+                            referenceImage.getPixel(sf::Vector2u(sf::Vector2i(x, y))))
+                            samePixels = false;
+                CHECK(samePixels);
+            }
+        }
+
+        CHECK(!sf::Font().preloadGlyphs(characters, {16}));
+    }
+
+    SECTION("preloadGlyphs() on several threads")
+    {
+        // Enough glyphs to be split between workers, which open the font again from the same memory
+        const auto       memory = loadIntoMemory("Graphics/tuffy.ttf");
+        const sf::Font   preloaded(memory.data(), memory.size());
+        const sf::Font   reference("Graphics/tuffy.ttf");
+        sf::String       characters;
+        for (char32_t codePoint = 0x20; codePoint < 0x7F; ++codePoint)
+            characters += codePoint;
+
+        CHECK(preloaded.preloadGlyphs(characters, {24}, true, 1));
+        for (const char32_t codePoint : characters)
+            (void)reference.getGlyph(codePoint, 24, true, 1);
+
+        for (const char32_t codePoint : characters)
+        {
+            const sf::Glyph& glyph = preloaded.getGlyph(codePoint, 24, true, 1);
+            CHECK(glyph.textureRect == reference.getGlyph(codePoint, 24, true, 1).textureRect);
+            CHECK(glyph.advance == reference.getGlyph(codePoint, 24, true, 1).advance);
+        }
+
+        // The staged rows, uploaded around the texture growth, leave the same pixels as uploading the glyphs one by one
+        REQUIRE(preloaded.getTextureCount(24) == 1);
+        REQUIRE(reference.getTextureCount(24) == 1);
+        const sf::Image preloadedImage = preloaded.getTexture(24).copyToImage();
+        const sf::Image referenceImage = reference.getTexture(24).copyToImage();
+        REQUIRE(preloadedImage.getSize() == referenceImage.getSize());
+        CHECK(preloadedImage.getSize().x > 128);
+        CHECK(std::equal(preloadedImage.getPixelsPtr(),
+                         preloadedImage.getPixelsPtr() + preloadedImage.getSize().x * preloadedImage.getSize().y * 4,
+                         referenceImage.getPixelsPtr()));
+    }
+
+    SECTION("Distance field mode")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isDistanceFieldEnabled());
+        CHECK(font.getDistanceFieldShader() == nullptr);
+
+        font.setDistanceFieldEnabled(true);
+        if (font.isDistanceFieldEnabled())
+        {
+            CHECK(font.getDistanceFieldShader() != nullptr);
+
+            // The threshold is 0.5 for filled glyphs, and lowered by the outline thickness at the reference size
+            CHECK(font.getDistanceFieldThreshold(16) == 0.5f);
+            CHECK(font.getDistanceFieldThreshold(48, 4) == Approx(0.25f));
+            CHECK(font.getDistanceFieldThreshold(96, 8) == Approx(0.25f));
+            CHECK(font.getDistanceFieldThreshold(16, 100) == 0.f);
+
+            // All the sizes share the same glyph texture, only the metrics are scaled
+            const sf::Glyph small = font.getGlyph(0x45, 24, false);
+            const sf::Glyph large = font.getGlyph(0x45, 96, false);
+            CHECK(small.textureRect == large.textureRect);
+            CHECK(large.advance == Approx(small.advance * 4));
+            CHECK(large.bounds.size.x == Approx(small.bounds.size.x * 4));
+            CHECK(&font.getTexture(24) == &font.getTexture(96));
+
+            // Outlines are drawn by the shader from the same glyphs
+            CHECK(font.getGlyph(0x45, 24, false, 2).textureRect == small.textureRect);
+
+            font.setDistanceFieldEnabled(false);
+            CHECK(!font.isDistanceFieldEnabled());
+            CHECK(&font.getTexture(24) != &font.getTexture(96));
+        }
+    }
+}
+
+// Run with `test-sfml-graphics "[.benchmark]"`; not part of the regular test run
+TEST_CASE("[Graphics] sf::Font benchmark", "[.benchmark]")
+{
+    const sf::Font    font("Graphics/tuffy.ttf");
+    const std::string text = "The quick brown fox jumps over the lazy dog. AVAST! Wavy Type, 0123456789.";
+
+    // Warm up the glyph cache so that only lookups are measured
+    for (const char c : text)
+        (void)font.getGlyph(static_cast<std::uint8_t>(c), 16, false);
+
+    BENCHMARK("getGlyph")
+    {
+        float advance = 0;
+        for (const char c : text)
+            advance += font.getGlyph(static_cast<std::uint8_t>(c), 16, false).advance;
+        return advance;
+    };
+
+    BENCHMARK("getKerning")
+    {
+        float kerning = 0;
+        for (std::size_t i = 1; i < text.size(); ++i)
+            kerning += font.getKerning(static_cast<std::uint8_t>(text[i - 1]), static_cast<std::uint8_t>(text[i]), 16);
+        return kerning;
+    };
+
+    BENCHMARK("hasGlyph")
+    {
+        std::size_t count = 0;
+        for (std::uint32_t codePoint = 0; codePoint < 0x3000; ++codePoint)
+            if (font.hasGlyph(codePoint))
+                ++count;
+        return count;
+    };
 }
@@ -1,14 +1,22 @@
 #include <SFML/Graphics/Image.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/ImageKernels.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <random>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -256,6 +264,35 @@ TEST_CASE("[Graphics] sf::Image")
         }
     }
 
+    SECTION("Copy semantics")
+    {
+        const sf::Image image(sf::Vector2u(10, 10), sf::Color::Red);
+
+        SECTION("Construction")
+        {
+            sf::Image imageCopy(image); // NOLINT(performance-unnecessary-copy-initialization)
+            REQUIRE(imageCopy.getSize() == sf::Vector2u(10, 10));
+            CHECK(imageCopy.getPixelsPtr() != image.getPixelsPtr());
+            CHECK(imageCopy.getPixel({9, 9}) == sf::Color::Red);
+
+            imageCopy.setPixel({9, 9}, sf::Color::Blue);
+            CHECK(image.getPixel({9, 9}) == sf::Color::Red);
+        }
+
+        SECTION("Assignment")
+        {
+            sf::Image imageCopy(sf::Vector2u(2, 2), sf::Color::Green);
+            imageCopy = image;
+            REQUIRE(imageCopy.getSize() == sf::Vector2u(10, 10));
+            CHECK(imageCopy.getPixelsPtr() != image.getPixelsPtr());
+            CHECK(imageCopy.getPixel({9, 9}) == sf::Color::Red);
+
+            imageCopy = sf::Image();
+            CHECK(imageCopy.getSize() == sf::Vector2u());
+            CHECK(imageCopy.getPixelsPtr() == nullptr);
+        }
+    }
+
     SECTION("loadFromFile()")
     {
         sf::Image image;
@@ -269,6 +306,26 @@ TEST_CASE("[Graphics] sf::Image")
             CHECK(image.getPixelsPtr() == nullptr);
         }
 
+        SECTION("Failed load leaves the image unchanged")
+        {
+            image.resize({4, 4}, sf::Color::Cyan);
+            CHECK(!image.loadFromFile("Graphics/invalid_shader.vert"));
+            CHECK(image.getSize() == sf::Vector2u(4, 4));
+            CHECK(image.getPixel({3, 3}) == sf::Color::Cyan);
+        }
+
+        SECTION("Same pixels as loadFromMemory()")
+        {
+            const auto memory = loadIntoMemory("Graphics/sfml-logo-big.png");
+            sf::Image  fromMemory;
+            REQUIRE(fromMemory.loadFromMemory(memory.data(), memory.size()));
+            REQUIRE(image.loadFromFile("Graphics/sfml-logo-big.png"));
+            REQUIRE(image.getSize() == fromMemory.getSize());
+            CHECK(std::equal(image.getPixelsPtr(),
+                             image.getPixelsPtr() + image.getSize().x * image.getSize().y * 4,
+                             fromMemory.getPixelsPtr()));
+        }
+
         SECTION("Successful load")
         {
             SECTION("bmp")
@@ -577,6 +634,54 @@ TEST_CASE("[Graphics] sf::Image")
             }
         }
 
+        SECTION("Copy (Image, Vector2u, IntRect, bool) with every pair of alpha values")
+        {
+            // Every pixel blends a different pair of alpha values, with pseudo-random colors
+            sf::Image     image1(sf::Vector2u(256, 256));
+            sf::Image     image2(sf::Vector2u(256, 256));
+            std::uint32_t seed = 1;
+            const auto    next = [&seed]
+            {
+                seed = seed * 1664525 + 1013904223;
+                return static_cast<std::uint8_t>(seed >> 24);
+            };
+            for (std::uint32_t i = 0; i < 256; ++i)
+            {
+                for (std::uint32_t j = 0; j < 256; ++j)
+                {
+                    image1.setPixel({i, j}, sf::Color(next(), next(), next(), static_cast<std::uint8_t>(j)));
+                    image2.setPixel({i, j}, sf::Color(next(), next(), next(), static_cast<std::uint8_t>(i)));
+                }
+            }
+
+            // Blend a sub-rectangle whose width isn't a multiple of any vector size
+            const sf::Image original = image1;
+            const sf::IntRect sourceRect(sf::Vector2i(0, 0), sf::Vector2i(253, 256));
+            CHECK(image1.copy(image2, sf::Vector2u(1, 0), sourceRect, true));
+
+            for (std::uint32_t i = 0; i < 253; ++i)
+            {
+                for (std::uint32_t j = 0; j < 256; ++j)
+                {
+                    const sf::Color src      = image2.getPixel({i, j});
+                    const sf::Color dst      = original.getPixel({i + 1, j});
+                    const auto      outAlpha = static_cast<std::uint8_t>(src.a + dst.a - src.a * dst.a / 255);
+                    const auto      blend    = [&](std::uint8_t s, std::uint8_t d)
+                    {
+                        if (outAlpha == 0)
+                            return s;
+                        return static_cast<std::uint8_t>((s * src.a + d * (outAlpha - src.a)) / outAlpha);
+                    };
+
+                    CHECK(image1.getPixel({i + 1, j}) ==
+                          sf::Color(blend(src.r, dst.r), blend(src.g, dst.g), blend(src.b, dst.b), outAlpha));
+                }
+            }
+
+            CHECK(image1.getPixel({0, 100}) == original.getPixel({0, 100}));
+            CHECK(image1.getPixel({254, 100}) == original.getPixel({254, 100}));
+        }
+
         SECTION("Copy (Out of bounds sourceRect)")
         {
             const sf::Image image1(sf::Vector2u(5, 5), sf::Color::Blue);
@@ -609,6 +714,32 @@ TEST_CASE("[Graphics] sf::Image")
             }
         }
 
+        SECTION("createMaskFromColor(Color, std::uint8_t) on an odd sized image")
+        {
+            // Pixels that only differ by one channel (including alpha) from the key must be left alone
+            const std::array colors = {sf::Color(10, 20, 30, 40),
+                                       sf::Color(11, 20, 30, 40),
+                                       sf::Color(10, 21, 30, 40),
+                                       sf::Color(10, 20, 31, 40),
+                                       sf::Color(10, 20, 30, 41)};
+
+            sf::Image image(sf::Vector2u(13, 7));
+            for (std::uint32_t i = 0; i < 13; ++i)
+                for (std::uint32_t j = 0; j < 7; ++j)
+                    image.setPixel({i, j}, colors[(i + j * 13) % colors.size()]);
+
+            image.createMaskFromColor(colors[0], 100);
+
+            for (std::uint32_t i = 0; i < 13; ++i)
+            {
+                for (std::uint32_t j = 0; j < 7; ++j)
+                {
+                    const std::size_t index = (i + j * 13) % colors.size();
+                    CHECK(image.getPixel({i, j}) == (index == 0 ? sf::Color(10, 20, 30, 100) : colors[index]));
+                }
+            }
+        }
+
         SECTION("createMaskFromColor(Color, std::uint8_t)")
         {
             sf::Image image(sf::Vector2u(10, 10), sf::Color::Blue);
@@ -633,6 +764,28 @@ TEST_CASE("[Graphics] sf::Image")
         CHECK(image.getPixel(sf::Vector2u(9, 0)) == sf::Color::Green);
     }
 
+    SECTION("Flip horizontally (all widths up to 40)")
+    {
+        for (std::uint8_t width = 1; width <= 40; ++width)
+        {
+            sf::Image image(sf::Vector2u(width, 2));
+            for (std::uint8_t x = 0; x < width; ++x)
+            {
+                image.setPixel({x, 0}, sf::Color(x, 0, 0, 255));
+                image.setPixel({x, 1}, sf::Color(0, x, 0, x));
+            }
+
+            image.flipHorizontally();
+
+            for (std::uint8_t x = 0; x < width; ++x)
+            {
+                const auto flippedX = static_cast<std::uint8_t>(width - 1 - x);
+                CHECK(image.getPixel({x, 0}) == sf::Color(flippedX, 0, 0, 255));
+                CHECK(image.getPixel({x, 1}) == sf::Color(0, flippedX, 0, flippedX));
+            }
+        }
+    }
+
     SECTION("Flip vertically")
     {
         sf::Image image(sf::Vector2u(10, 10), sf::Color::Red);
@@ -642,3 +795,91 @@ TEST_CASE("[Graphics] sf::Image")
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
 }
+
+TEST_CASE("[Graphics] sf::priv::getImageKernels")
+{
+    const std::vector<sf::priv::ImageKernels>& kernels = sf::priv::getImageKernels();
+    REQUIRE(!kernels.empty());
+    CHECK(std::string(kernels.front().name) == "Scalar");
+
+    // Random pixels, with a color to mask and fully transparent and opaque pixels among them
+    const sf::Color  maskedColor(12, 34, 56, 78);
+    std::minstd_rand random(1234);
+    const auto       randomPixels = [&](std::size_t pixelCount)
+    {
+        std::vector<std::uint8_t> pixels(pixelCount * 4);
+        for (std::uint8_t& channel : pixels)
+            channel = static_cast<std::uint8_t>(random() >> 8);
+
+        for (std::size_t i = 0; i < pixelCount; i += 3)
+            pixels[i * 4 + 3] = (i % 2) ? 0 : 255;
+
+        for (std::size_t i = 0; i < pixelCount; i += 5)
+        {
+            pixels[i * 4 + 0] = maskedColor.r;
+            pixels[i * 4 + 1] = maskedColor.g;
+            pixels[i * 4 + 2] = maskedColor.b;
+            pixels[i * 4 + 3] = maskedColor.a;
+        }
+
+        return pixels;
+    };
+
+    // Every vector implementation must match the scalar one, with rows that don't fill whole vectors too
+    const sf::priv::ImageKernels&     scalar = kernels.front();
+    const std::array<std::size_t, 19> pixelCounts{0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000};
+    for (auto implementation = kernels.begin() + 1; implementation != kernels.end(); ++implementation)
+    {
+        INFO("Implementation: " << implementation->name);
+
+        for (const std::size_t pixelCount : pixelCounts)
+        {
+            INFO("Pixel count: " << pixelCount);
+
+            std::vector<std::uint8_t> expected = randomPixels(pixelCount);
+            std::vector<std::uint8_t> actual   = expected;
+            scalar.maskFromColor(expected.data(), pixelCount, maskedColor, 100);
+            implementation->maskFromColor(actual.data(), pixelCount, maskedColor, 100);
+            CHECK(actual == expected);
+
+            const std::vector<std::uint8_t> source = randomPixels(pixelCount);
+            expected                               = randomPixels(pixelCount);
+            actual                                 = expected;
+            scalar.blendPixels(source.data(), expected.data(), pixelCount);
+            implementation->blendPixels(source.data(), actual.data(), pixelCount);
+            CHECK(actual == expected);
+
+            expected = randomPixels(pixelCount);
+            actual   = expected;
+            scalar.reversePixels(expected.data(), pixelCount);
+            implementation->reversePixels(actual.data(), pixelCount);
+            CHECK(actual == expected);
+        }
+    }
+}
+
+TEST_CASE("[Graphics] sf::Image pixel operations throughput", "[.benchmark]")
+{
+    // Run with `test-sfml-graphics "[.benchmark]"`; not part of the regular test run
+    const sf::Image source(sf::Vector2u(4096, 4096), sf::Color(200, 100, 50, 128));
+    sf::Image       image(sf::Vector2u(4096, 4096), sf::Color(10, 20, 30, 200));
+
+    const auto megabytes  = static_cast<double>(image.getSize().x) * image.getSize().y * 4 / (1024 * 1024);
+    const auto throughput = [megabytes](const std::string& name, auto&& operation)
+    {
+        constexpr int runs = 10;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i)
+            operation();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        WARN(name << ": " << megabytes * runs / elapsed.count() << " MB/s");
+    };
+
+    throughput("createMaskFromColor", [&] { image.createMaskFromColor(sf::Color(10, 20, 30, 200), 100); });
+    throughput("copy with alpha", [&] { CHECK(image.copy(source, {0, 0}, {}, true)); });
+    throughput("copy without alpha", [&] { CHECK(image.copy(source, {0, 0}, {}, false)); });
+    throughput("flipHorizontally", [&] { image.flipHorizontally(); });
+    throughput("flipVertically", [&] { image.flipVertically(); });
+}
@@ -0,0 +1,131 @@
+#include <SFML/Graphics/ImageLoader.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/FileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ImageLoader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_move_assignable_v<sf::ImageLoader>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ImageLoader loader(3);
+        CHECK(loader.getThreadCount() == 3);
+
+        const sf::ImageLoader defaultLoader;
+        CHECK(defaultLoader.getThreadCount() >= 1);
+    }
+
+    sf::ImageLoader loader(2);
+
+    SECTION("loadFromFile()")
+    {
+        SECTION("Invalid file")
+        {
+            std::future<sf::Image> image = loader.loadFromFile("this/does/not/exist.jpg");
+            CHECK_THROWS_AS(image.get(), sf::Exception);
+        }
+
+        SECTION("Successful load")
+        {
+            const sf::Image image = loader.loadFromFile("Graphics/sfml-logo-big.png").get();
+            CHECK(image.getSize() == sf::Vector2u(1001, 304));
+            CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+    }
+
+    SECTION("loadFromFile() with a callback")
+    {
+        std::promise<std::optional<sf::Image>> valid;
+        std::promise<std::optional<sf::Image>> invalid;
+        loader.loadFromFile("Graphics/sfml-logo-big.bmp",
+                            [&valid](std::optional<sf::Image> image) { valid.set_value(std::move(image)); });
+        loader.loadFromFile("this/does/not/exist.jpg",
+                            [&invalid](std::optional<sf::Image> image) { invalid.set_value(std::move(image)); });
+
+        const std::optional<sf::Image> image = valid.get_future().get();
+        REQUIRE(image);
+        CHECK(image->getPixel({200, 150}) == sf::Color(144, 208, 62));
+        CHECK(!invalid.get_future().get());
+    }
+
+    SECTION("loadFromFiles()")
+    {
+        auto images = loader.loadFromFiles({"Graphics/sfml-logo-big.png",
+                                            "Graphics/sfml-logo-big.bmp",
+                                            "this/does/not/exist.jpg",
+                                            "Graphics/sfml-logo-big.gif"});
+        REQUIRE(images.size() == 4);
+        CHECK(images[0].get().getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+        CHECK(images[1].get().getPixel({0, 0}) == sf::Color::White);
+        CHECK_THROWS_AS(images[2].get(), sf::Exception);
+        CHECK(images[3].get().getPixel({200, 150}) == sf::Color(146, 210, 62));
+    }
+
+    SECTION("loadFromStream()")
+    {
+        sf::FileInputStream stream("Graphics/sfml-logo-big.jpg");
+        const sf::Image     image = loader.loadFromStream(stream).get();
+        CHECK(image.getSize() == sf::Vector2u(1001, 304));
+        CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+    }
+
+    SECTION("Queued images are decoded before destruction")
+    {
+        std::atomic<int> loaded{};
+        {
+            sf::ImageLoader shortLived(1);
+            for (int i = 0; i < 4; ++i)
+                shortLived.loadFromFile("Graphics/sfml-logo-big.bmp",
+                                        [&loaded](const std::optional<sf::Image>& image) { loaded += image ? 1 : 0; });
+        }
+
+        CHECK(loaded == 4);
+    }
+}
+
+TEST_CASE("[Graphics] sf::ImageLoader textures", runDisplayTests())
+{
+    sf::ImageLoader loader(2);
+
+    std::future<sf::Texture> texture = loader.loadTextureFromFile("Graphics/sfml-logo-big.png");
+    std::future<sf::Texture> invalid = loader.loadTextureFromFile("this/does/not/exist.jpg");
+
+    // Decoding failures are reported without going through the upload stage
+    CHECK_THROWS_AS(invalid.get(), sf::Exception);
+
+    // Textures are only created when the owner of the context uploads them
+    CHECK(texture.wait_for(std::chrono::milliseconds(100)) == std::future_status::timeout);
+
+    std::size_t uploaded = 0;
+    while (uploaded == 0)
+    {
+        uploaded = loader.uploadTextures(1);
+        if (uploaded == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    CHECK(uploaded == 1);
+    CHECK(loader.uploadTextures() == 0);
+    CHECK(texture.get().getSize() == sf::Vector2u(1001, 304));
+}
@@ -10,6 +10,28 @@
 
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
+    SECTION("Batching")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+        shape.setPosition({50, 0});
+        shape.setFillColor(sf::Color::Blue);
+        renderTexture.draw(shape);
+        CHECK(renderTexture.getDrawStatistics().mergedDraws == 1);
+
+        renderTexture.display();
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
     SECTION("Stencil Tests")
     {
         sf::RenderTexture renderTexture({100, 100}, sf::ContextSettings{0 /* depthBits */, 8 /* stencilBits */});
@@ -53,6 +53,19 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Batching")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.flush();
+        CHECK(renderTarget.getDrawStatistics().drawCalls == 0);
+        CHECK(renderTarget.getDrawStatistics().mergedDraws == 0);
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
@@ -1,6 +1,9 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
 #include <SFML/System/Exception.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -125,4 +128,20 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         const sf::RenderTexture renderTexture({64, 64});
         CHECK(renderTexture.getTexture().getSize() == sf::Vector2u(64, 64));
     }
+
+    SECTION("getTexture() with pending batched draws")
+    {
+        sf::RenderTexture renderTexture({64, 64});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({64, 64});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+
+        // No display(), the FBO renders directly into the texture once the batch is flushed
+        renderTexture.flush();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({32, 32}) == sf::Color::Green);
+    }
 }
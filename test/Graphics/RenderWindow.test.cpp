@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/Window/VideoMode.hpp>
@@ -89,4 +90,38 @@ TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
         texture.update(window);
         CHECK(texture.copyToImage().getPixel(sf::Vector2u(196, 196)) == sf::Color::Blue);
     }
+
+    SECTION("Batching")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24),
+                                "Window Title",
+                                sf::Style::Default,
+                                sf::State::Windowed,
+                                sf::ContextSettings{});
+        REQUIRE(window.getSize() == sf::Vector2u(256, 256));
+        window.setBatchingEnabled(true);
+
+        sf::Texture        texture(window.getSize());
+        sf::RectangleShape shape(sf::Vector2f(window.getSize()));
+
+        SECTION("Texture update without display()")
+        {
+            window.clear(sf::Color::Red);
+            shape.setFillColor(sf::Color::Green);
+            window.draw(shape);
+            window.flush();
+            texture.update(window);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(128, 128)) == sf::Color::Green);
+        }
+
+        SECTION("display()")
+        {
+            window.clear(sf::Color::Red);
+            window.draw(shape);
+            const auto drawCalls = window.getDrawStatistics().drawCalls;
+
+            window.display();
+            CHECK(window.getDrawStatistics().drawCalls == drawCalls + 1);
+        }
+    }
 }
@@ -0,0 +1,113 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, sf::Texture&&>);
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, const sf::Texture&&>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+    }
+
+    const sf::Texture texture(sf::Vector2u(64, 64));
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch batch(texture);
+        CHECK(&batch.getTexture() == &texture);
+        CHECK(batch.getSpriteCount() == 0);
+        CHECK(batch.getPosition() == sf::Vector2f());
+    }
+
+    SECTION("Set/get texture")
+    {
+        const sf::Texture otherTexture(sf::Vector2u(64, 64));
+        sf::SpriteBatch   batch(texture);
+        batch.setTexture(otherTexture);
+        CHECK(&batch.getTexture() == &otherTexture);
+    }
+
+    SECTION("Add/remove sprites")
+    {
+        sf::SpriteBatch batch(texture);
+        CHECK(batch.add({1, 2}, {{0, 0}, {16, 16}}) == 0);
+        CHECK(batch.add({3, 4}, {{16, 0}, {16, 16}}, sf::Color::Red) == 1);
+        CHECK(batch.add({5, 6}, {{32, 0}, {16, 16}}, sf::Color::Blue) == 2);
+        CHECK(batch.getSpriteCount() == 3);
+        CHECK(batch.getPosition(0) == sf::Vector2f(1, 2));
+        CHECK(batch.getOrigin(0) == sf::Vector2f());
+        CHECK(batch.getRotation(0) == sf::Angle::Zero);
+        CHECK(batch.getScale(0) == sf::Vector2f(1, 1));
+        CHECK(batch.getTextureRect(0) == sf::IntRect({0, 0}, {16, 16}));
+        CHECK(batch.getColor(0) == sf::Color::White);
+
+        batch.remove(0);
+        CHECK(batch.getSpriteCount() == 2);
+        CHECK(batch.getPosition(0) == sf::Vector2f(5, 6));
+        CHECK(batch.getTextureRect(0) == sf::IntRect({32, 0}, {16, 16}));
+        CHECK(batch.getColor(0) == sf::Color::Blue);
+        CHECK(batch.getPosition(1) == sf::Vector2f(3, 4));
+
+        batch.clear();
+        CHECK(batch.getSpriteCount() == 0);
+    }
+
+    SECTION("Set/get sprite properties")
+    {
+        sf::SpriteBatch batch(texture);
+        batch.add({}, {{0, 0}, {16, 16}});
+        batch.setPosition(0, {10, 20});
+        batch.setOrigin(0, {8, 8});
+        batch.setRotation(0, sf::degrees(-90));
+        batch.setScale(0, {2, 3});
+        batch.setTextureRect(0, {{8, 8}, {8, 8}});
+        batch.setColor(0, sf::Color::Green);
+        CHECK(batch.getPosition(0) == sf::Vector2f(10, 20));
+        CHECK(batch.getOrigin(0) == sf::Vector2f(8, 8));
+        CHECK(batch.getRotation(0) == sf::degrees(270));
+        CHECK(batch.getScale(0) == sf::Vector2f(2, 3));
+        CHECK(batch.getTextureRect(0) == sf::IntRect({8, 8}, {8, 8}));
+        CHECK(batch.getColor(0) == sf::Color::Green);
+    }
+
+    SECTION("Draw")
+    {
+        sf::Image image({4, 4}, sf::Color::White);
+        const sf::Texture whiteTexture(image);
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Black);
+
+        sf::SpriteBatch batch(whiteTexture);
+        batch.add({0, 0}, {{0, 0}, {4, 4}}, sf::Color::Red);
+        batch.add({50, 50}, {{0, 0}, {4, 4}}, sf::Color::Green);
+        batch.setScale(0, {10, 10});
+        batch.setScale(1, {10, 10});
+
+        renderTexture.draw(batch);
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+
+        // Only the modified sprite is updated before the next draw
+        batch.setColor(1, sf::Color::Blue);
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(batch);
+        renderTexture.display();
+
+        const sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({20, 20}) == sf::Color::Red);
+        CHECK(result.getPixel({70, 70}) == sf::Color::Blue);
+        CHECK(result.getPixel({45, 45}) == sf::Color::Black);
+    }
+}
@@ -2,11 +2,15 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/FontTextureSize.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
 #include <type_traits>
 
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
@@ -84,6 +88,104 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getString() == "abcdefghijklmnopqrstuvwxyz");
     }
 
+    SECTION("append(), insert(), and erase()")
+    {
+        sf::Text text(font, "Hello\nworld", 18);
+        text.setStyle(sf::Text::Underlined);
+        text.setOutlineThickness(1);
+        (void)text.getLocalBounds();
+
+        // The layout of an edited text must match the layout of a text created from the final string
+        const auto checkLayout = [&](const sf::String& expected)
+        {
+            CHECK(text.getString() == expected);
+
+            sf::Text reference(font, expected, 18);
+            reference.setStyle(sf::Text::Underlined);
+            reference.setOutlineThickness(1);
+            CHECK(text.getLocalBounds() == reference.getLocalBounds());
+            for (std::size_t i = 0; i <= expected.getSize(); ++i)
+                CHECK(text.findCharacterPos(i) == reference.findCharacterPos(i));
+        };
+
+        text.append("!\nHow are you?");
+        checkLayout("Hello\nworld!\nHow are you?");
+
+        text.insert(5, ", dear");
+        checkLayout("Hello, dear\nworld!\nHow are you?");
+
+        text.erase(12, 7);
+        checkLayout("Hello, dear\nHow are you?");
+
+        text.setString("Hello, dear\nWho are you?\n");
+        checkLayout("Hello, dear\nWho are you?\n");
+
+        text.erase(0, text.getString().getSize());
+        checkLayout("");
+
+        text.append("Back\nagain");
+        checkLayout("Back\nagain");
+    }
+
+    SECTION("append(), insert(), and erase() with glyphs in several font textures")
+    {
+        // Limit the size of the font textures, so that the glyphs spill into several of them
+        struct MaximumSizeGuard
+        {
+            MaximumSizeGuard()
+            {
+                sf::priv::setFontTextureMaximumSize(128);
+            }
+            ~MaximumSizeGuard()
+            {
+                sf::priv::setFontTextureMaximumSize(0);
+            }
+        } guard;
+
+        const sf::Font   spillingFont("Graphics/tuffy.ttf");
+        const sf::String characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        sf::Text         text(spillingFont, "ABCDEFGH\nIJKLM", 40);
+        text.setOutlineThickness(1);
+
+        // Load all the glyphs first, so that the font textures don't change during the edits
+        sf::Text allGlyphs(spillingFont, characters, 40);
+        allGlyphs.setOutlineThickness(1);
+        (void)allGlyphs.getLocalBounds();
+        (void)text.getLocalBounds();
+        REQUIRE(spillingFont.getTextureCount(40) > 1);
+
+        // The edited text must be drawn exactly like a text created from the final string
+        const auto render = [&](const sf::Text& drawable)
+        {
+            sf::RenderTexture renderTexture({512, 256});
+            renderTexture.clear();
+            renderTexture.draw(drawable);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+        const auto checkRendering = [&](const sf::String& expected)
+        {
+            sf::Text reference(spillingFont, expected, 40);
+            reference.setOutlineThickness(1);
+
+            const sf::Image image         = render(text);
+            const sf::Image expectedImage = render(reference);
+            CHECK(text.getString() == expected);
+            CHECK(std::equal(image.getPixelsPtr(),
+                             image.getPixelsPtr() + image.getSize().x * image.getSize().y * 4,
+                             expectedImage.getPixelsPtr()));
+        };
+
+        text.append("NOP\nQRSTUVWXYZ");
+        checkRendering("ABCDEFGH\nIJKLMNOP\nQRSTUVWXYZ");
+
+        text.insert(9, "ZYX");
+        checkRendering("ABCDEFGH\nZYXIJKLMNOP\nQRSTUVWXYZ");
+
+        text.erase(21, 4);
+        checkRendering("ABCDEFGH\nZYXIJKLMNOP\nUVWXYZ");
+    }
+
     SECTION("Set/get font")
     {
         sf::Text       text(font);
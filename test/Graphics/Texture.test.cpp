@@ -269,6 +269,20 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 
             CHECK(texture.getNativeHandle() != 0);
         }
+
+        SECTION("Subarea pixels")
+        {
+            sf::Image image(sf::Vector2u(10, 15), sf::Color::Red);
+            image.setPixel(sf::Vector2u(2, 3), sf::Color::Green);
+            image.setPixel(sf::Vector2u(6, 9), sf::Color::Blue);
+
+            sf::Texture texture;
+            REQUIRE(texture.loadFromImage(image, false, {{2, 3}, {5, 7}}));
+            const sf::Image copy = texture.copyToImage();
+            CHECK(copy.getPixel(sf::Vector2u(0, 0)) == sf::Color::Green);
+            CHECK(copy.getPixel(sf::Vector2u(4, 6)) == sf::Color::Blue);
+            CHECK(copy.getPixel(sf::Vector2u(1, 1)) == sf::Color::Red);
+        }
     }
 
     SECTION("Copy semantics")
@@ -358,6 +372,52 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("updateAsync()")
+    {
+        constexpr std::uint8_t yellow[] = {0xFF, 0xFF, 0x00, 0xFF};
+        constexpr std::uint8_t cyan[]   = {0x00, 0xFF, 0xFF, 0xFF};
+
+        SECTION("Pixels, size and destination")
+        {
+            sf::Texture texture(sf::Vector2u(2, 1));
+            texture.updateAsync(yellow, sf::Vector2u(1, 1), sf::Vector2u(0, 0));
+            texture.updateAsync(cyan, sf::Vector2u(1, 1), sf::Vector2u(1, 0));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Yellow);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+        }
+
+        SECTION("More uploads than pixel buffers")
+        {
+            sf::Texture texture(sf::Vector2u(16, 16));
+            for (const auto color :
+                 {sf::Color::Red, sf::Color::Green, sf::Color::Blue, sf::Color::Yellow, sf::Color::Cyan})
+                texture.updateAsync(sf::Image(sf::Vector2u(16, 16), color));
+
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 7)) == sf::Color::Cyan);
+        }
+
+        SECTION("Image and destination")
+        {
+            sf::Texture     texture(sf::Vector2u(16, 32));
+            const sf::Image image1(sf::Vector2u(16, 16), sf::Color::Red);
+            const sf::Image image2(sf::Vector2u(16, 16), sf::Color::Green);
+            texture.updateAsync(image1, sf::Vector2u(0, 0));
+            texture.updateAsync(image2, sf::Vector2u(0, 16));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 7)) == sf::Color::Red);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 22)) == sf::Color::Green);
+        }
+    }
+
+    SECTION("Set/get flushed on update")
+    {
+        sf::Texture texture(sf::Vector2u(64, 64));
+        CHECK(!texture.isFlushedOnUpdate());
+        texture.setFlushedOnUpdate(true);
+        CHECK(texture.isFlushedOnUpdate());
+        texture.setFlushedOnUpdate(false);
+        CHECK(!texture.isFlushedOnUpdate());
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture(sf::Vector2u(64, 64));
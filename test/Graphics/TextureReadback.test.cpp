@@ -0,0 +1,97 @@
+#include <SFML/Graphics/TextureReadback.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <utility>
+
+TEST_CASE("[Graphics] sf::TextureReadback", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureReadback>);
+    }
+
+    SECTION("Default constructor")
+    {
+        sf::TextureReadback readback;
+        CHECK(readback.isReady());
+        CHECK(readback.getImage().getSize() == sf::Vector2u());
+    }
+
+    SECTION("Empty texture")
+    {
+        const sf::Texture   texture;
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        CHECK(readback.isReady());
+        CHECK(readback.getImage().getSize() == sf::Vector2u());
+    }
+
+    SECTION("Texture")
+    {
+        sf::Image image(sf::Vector2u(10, 15), sf::Color::Red);
+        image.setPixel(sf::Vector2u(2, 3), sf::Color::Green);
+        image.setPixel(sf::Vector2u(9, 14), sf::Color::Blue);
+        sf::Texture texture(image);
+
+        sf::TextureReadback readback = texture.copyToImageAsync();
+
+        // Changes made after the copy was started are not part of it
+        texture.update(sf::Image(sf::Vector2u(10, 15), sf::Color::Yellow));
+
+        const sf::Image copy = readback.getImage();
+        REQUIRE(copy.getSize() == sf::Vector2u(10, 15));
+        CHECK(copy.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+        CHECK(copy.getPixel(sf::Vector2u(2, 3)) == sf::Color::Green);
+        CHECK(copy.getPixel(sf::Vector2u(9, 14)) == sf::Color::Blue);
+
+        // The image can be retrieved only once
+        CHECK(readback.isReady());
+        CHECK(readback.getImage().getSize() == sf::Vector2u());
+    }
+
+    SECTION("Polling")
+    {
+        const sf::Texture   texture(sf::Image(sf::Vector2u(64, 64), sf::Color::Cyan));
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        while (!readback.isReady())
+        {
+        }
+
+        CHECK(readback.getImage().getPixel(sf::Vector2u(63, 63)) == sf::Color::Cyan);
+    }
+
+    SECTION("Flipped texture")
+    {
+        sf::RenderTexture renderTexture(sf::Vector2u(32, 32));
+        sf::RectangleShape rectangle(sf::Vector2f(32, 8));
+        rectangle.setFillColor(sf::Color::Green);
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(rectangle);
+        renderTexture.display();
+
+        sf::TextureReadback readback = renderTexture.getTexture().copyToImageAsync();
+        const sf::Image     copy     = readback.getImage();
+        REQUIRE(copy.getSize() == sf::Vector2u(32, 32));
+        CHECK(copy.getPixel(sf::Vector2u(0, 0)) == sf::Color::Green);
+        CHECK(copy.getPixel(sf::Vector2u(31, 31)) == sf::Color::Red);
+    }
+
+    SECTION("Move semantics")
+    {
+        const sf::Texture   texture(sf::Image(sf::Vector2u(4, 4), sf::Color::Blue));
+        sf::TextureReadback readback = texture.copyToImageAsync();
+        sf::TextureReadback moved(std::move(readback));
+        CHECK(moved.getImage().getPixel(sf::Vector2u(3, 3)) == sf::Color::Blue);
+    }
+}
@@ -1,8 +1,16 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -45,4 +53,166 @@ TEST_CASE("[Network] sf::Http")
             CHECK(response.getBody().empty());
         }
     }
+
+    SECTION("sendRequest()/sendRequests()")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // Serve canned responses on a single kept alive connection
+        std::size_t connections = 0;
+        std::thread server(
+            [&listener, &connections]
+            {
+                sf::TcpSocket socket;
+                if (listener.accept(socket) != sf::Socket::Status::Done)
+                    return;
+                ++connections;
+
+                const std::string responses[] = {"HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nfirst",
+                                                 "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                                 "3\r\nsec\r\n3;ext\r\nond\r\n0\r\nTrailer: yes\r\n\r\n",
+                                                 "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n",
+                                                 "HTTP/1.1 200 OK\r\nContent-Length: 8\r\n\r\nstreamed"};
+
+                std::string received;
+                std::size_t served = 0;
+                while (served < std::size(responses))
+                {
+                    std::size_t end = received.find("\r\n\r\n");
+                    if (end == std::string::npos)
+                    {
+                        char        buffer[1024];
+                        std::size_t size = 0;
+                        if (socket.receive(buffer, sizeof(buffer), size) != sf::Socket::Status::Done)
+                            return;
+                        received.append(buffer, size);
+                        continue;
+                    }
+
+                    received.erase(0, end + 4);
+                    if (socket.send(responses[served].data(), responses[served].size()) != sf::Socket::Status::Done)
+                        return;
+                    ++served;
+                }
+            });
+
+        sf::Http          http("127.0.0.1", listener.getLocalPort());
+        sf::Http::Request request("/first");
+        request.setHttpVersion(1, 1);
+
+        const sf::Http::Response first = http.sendRequest(request);
+        CHECK(first.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(first.getMajorHttpVersion() == 1);
+        CHECK(first.getMinorHttpVersion() == 1);
+        CHECK(first.getBody() == "first");
+
+        std::vector<sf::Http::Request> requests(2, request);
+        requests[0].setUri("/second");
+        requests[1].setUri("/missing");
+        const std::vector<sf::Http::Response> responses = http.sendRequests(requests);
+        REQUIRE(responses.size() == 2);
+        CHECK(responses[0].getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(responses[0].getBody() == "second");
+        CHECK(responses[0].getField("trailer") == "yes");
+        CHECK(responses[1].getStatus() == sf::Http::Response::Status::NotFound);
+        CHECK(responses[1].getBody().empty());
+
+        std::ostringstream       body;
+        const sf::Http::Response streamed = http.sendRequest(request, body);
+        CHECK(streamed.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(streamed.getBody().empty());
+        CHECK(body.str() == "streamed");
+
+        server.join();
+        CHECK(connections == 1);
+    }
+
+    SECTION("Malformed and truncated responses")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // Answer a single request with the given data, then close the connection
+        const auto exchange = [&listener](const std::string& data)
+        {
+            std::thread server(
+                [&listener, &data]
+                {
+                    sf::TcpSocket socket;
+                    if (listener.accept(socket) != sf::Socket::Status::Done)
+                        return;
+
+                    std::string received;
+                    while (received.find("\r\n\r\n") == std::string::npos)
+                    {
+                        char        buffer[1024];
+                        std::size_t size = 0;
+                        if (socket.receive(buffer, sizeof(buffer), size) != sf::Socket::Status::Done)
+                            return;
+                        received.append(buffer, size);
+                    }
+
+                    (void)socket.send(data.data(), data.size());
+                });
+
+            sf::Http                 http("127.0.0.1", listener.getLocalPort());
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/"));
+            server.join();
+            return response;
+        };
+
+        SECTION("Truncated body")
+        {
+            const sf::Http::Response response = exchange("HTTP/1.0 200 OK\r\nContent-Length: 10\r\n\r\nshort");
+            CHECK(response.getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(response.getBody() == "short");
+        }
+
+        SECTION("Truncated chunked body")
+        {
+            const sf::Http::Response response = exchange(
+                "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabc\r\n5\r\nde");
+            CHECK(response.getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(response.getBody() == "abcde");
+        }
+
+        SECTION("Chunked body")
+        {
+            const sf::Http::Response response = exchange(
+                "HTTP/1.1 200 OK\r\nTransfer-Encoding: Chunked\r\n\r\nA\r\n0123456789\r\n1\r\n!\r\n0\r\n\r\n");
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "0123456789!");
+        }
+
+        SECTION("Invalid chunk size")
+        {
+            const sf::Http::Response response = exchange(
+                "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\nabc\r\n0\r\n\r\n");
+            CHECK(response.getStatus() == sf::Http::Response::Status::InvalidResponse);
+        }
+
+        SECTION("Invalid status line")
+        {
+            CHECK(exchange("HTTP/x.1 200 OK\r\n\r\n").getStatus() == sf::Http::Response::Status::InvalidResponse);
+            CHECK(exchange("HTTP/\xff.1 200 OK\r\n\r\n").getStatus() == sf::Http::Response::Status::InvalidResponse);
+            CHECK(exchange("HTTP/1.1 OK\r\n\r\n").getStatus() == sf::Http::Response::Status::InvalidResponse);
+        }
+
+        SECTION("Malformed header")
+        {
+            const sf::Http::Response response = exchange(
+                "HTTP/1.0 200 OK\r\nnot a field\r\nContent-Length: 2\r\nX-Empty:\r\n\r\nok");
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getField("not a field").empty());
+            CHECK(response.getField("x-empty").empty());
+            CHECK(response.getBody() == "ok");
+        }
+
+        SECTION("Truncated header")
+        {
+            const sf::Http::Response response = exchange("HTTP/1.1 200 OK\r\nContent-Len");
+            CHECK(response.getStatus() == sf::Http::Response::Status::InvalidResponse);
+        }
+    }
 }
@@ -11,6 +11,8 @@
 #include <vector>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -268,6 +270,58 @@ TEST_CASE("[Network] sf::Packet")
         }
     }
 
+    SECTION("readArray()/writeArray()")
+    {
+        SECTION("Same format as the stream operators")
+        {
+            const std::array<std::int64_t, 3> values{-1, 0x0102030405060708, 42};
+
+            sf::Packet packet;
+            packet.writeArray(values.data(), values.size());
+
+            sf::Packet expected;
+            expected << values[0] << values[1] << values[2];
+            REQUIRE(packet.getDataSize() == expected.getDataSize());
+            CHECK(std::memcmp(packet.getData(), expected.getData(), expected.getDataSize()) == 0);
+        }
+
+        SECTION("Round trip")
+        {
+            const std::array<std::uint16_t, 4> shorts{0, 1, 0x1234, 0xFFFF};
+            const std::array<std::int32_t, 3>  ints{-5, 0, 123'456'789};
+            const std::array<float, 2>         floats{1.5f, -2.25f};
+
+            sf::Packet packet;
+            packet.writeArray(shorts.data(), shorts.size())
+                .writeArray(ints.data(), ints.size())
+                .writeArray(floats.data(), floats.size());
+            CHECK(packet.getDataSize() == sizeof(shorts) + sizeof(ints) + sizeof(floats));
+
+            std::array<std::uint16_t, 4> readShorts{};
+            std::array<std::int32_t, 3>  readInts{};
+            std::array<float, 2>         readFloats{};
+            CHECK(packet.readArray(readShorts.data(), readShorts.size())
+                      .readArray(readInts.data(), readInts.size())
+                      .readArray(readFloats.data(), readFloats.size()));
+            CHECK(readShorts == shorts);
+            CHECK(readInts == ints);
+            CHECK(readFloats == floats);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Not enough data")
+        {
+            const std::array<std::uint8_t, 3> bytes{1, 2, 3};
+
+            sf::Packet packet;
+            packet.writeArray(bytes.data(), bytes.size());
+
+            std::array<std::uint16_t, 2> values{};
+            CHECK_FALSE(packet.readArray(values.data(), values.size()));
+            CHECK(packet.getReadPosition() == 0);
+        }
+    }
+
     SECTION("onSend")
     {
         Packet      packet;
@@ -0,0 +1,102 @@
+#include <SFML/Network/PacketPool.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Network] sf::PacketPool")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::PacketPool>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::PacketPool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::PacketPool pool(512, 4);
+        CHECK(pool.getBufferCapacity() == 512);
+
+        const sf::PacketPool::Statistics statistics = pool.getStatistics();
+        CHECK(statistics.allocatedBuffers == 0);
+        CHECK(statistics.freeBuffers == 0);
+        CHECK(statistics.borrowedBuffers == 0);
+        CHECK(statistics.reusedBuffers == 0);
+        CHECK(statistics.discardedBuffers == 0);
+    }
+
+    SECTION("reserve()")
+    {
+        sf::PacketPool pool(512, 4);
+        pool.reserve(2);
+        CHECK(pool.getStatistics().allocatedBuffers == 2);
+        CHECK(pool.getStatistics().freeBuffers == 2);
+
+        pool.reserve(10);
+        CHECK(pool.getStatistics().allocatedBuffers == 4);
+        CHECK(pool.getStatistics().freeBuffers == 4);
+    }
+
+    SECTION("Borrow and give back buffers")
+    {
+        sf::PacketPool pool(512, 1);
+
+        {
+            sf::Packet first(pool);
+            first << 42;
+            CHECK(pool.getStatistics().borrowedBuffers == 1);
+            CHECK(pool.getStatistics().allocatedBuffers == 1);
+
+            // Copies borrow from the same pool, moves take the buffer along
+            const sf::Packet copy(first);
+            CHECK(copy.getDataSize() == first.getDataSize());
+            CHECK(pool.getStatistics().borrowedBuffers == 2);
+
+            const sf::Packet moved(std::move(first));
+            CHECK(moved.getDataSize() == copy.getDataSize());
+            CHECK(pool.getStatistics().borrowedBuffers == 2);
+        }
+
+        // Only one buffer fits in the pool, the other one is freed
+        sf::PacketPool::Statistics statistics = pool.getStatistics();
+        CHECK(statistics.borrowedBuffers == 0);
+        CHECK(statistics.freeBuffers == 1);
+        CHECK(statistics.discardedBuffers == 1);
+
+        const sf::Packet packet(pool);
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getData() == nullptr);
+
+        statistics = pool.getStatistics();
+        CHECK(statistics.allocatedBuffers == 2);
+        CHECK(statistics.reusedBuffers == 1);
+        CHECK(statistics.freeBuffers == 0);
+    }
+
+    SECTION("Oversized buffers are not kept")
+    {
+        sf::PacketPool pool(16, 4);
+
+        {
+            const std::vector<std::uint8_t> data(1000);
+            sf::Packet                      big(pool);
+            big.append(data.data(), data.size());
+            sf::Packet small(pool);
+            small << 42;
+        }
+
+        const sf::PacketPool::Statistics statistics = pool.getStatistics();
+        CHECK(statistics.borrowedBuffers == 0);
+        CHECK(statistics.freeBuffers == 1);
+        CHECK(statistics.discardedBuffers == 1);
+    }
+}
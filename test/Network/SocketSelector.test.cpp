@@ -5,7 +5,11 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Network] sf::SocketSelector")
 {
@@ -23,5 +27,58 @@ TEST_CASE("[Network] sf::SocketSelector")
     {
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets().empty());
+    }
+
+    SECTION("wait()")
+    {
+        REQUIRE(socket.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        sf::UdpSocket sender;
+        REQUIRE(sender.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+
+        sf::SocketSelector socketSelector;
+        socketSelector.add(socket);
+        socketSelector.add(sender);
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+        CHECK(socketSelector.getReadySockets().empty());
+
+        const std::array<std::uint8_t, 4> data{1, 2, 3, 4};
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, socket.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(socket));
+        CHECK(!socketSelector.isReady(sender));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&socket});
+
+        const sf::SocketSelector copy(socketSelector);
+        CHECK(copy.isReady(socket));
+        CHECK(copy.getReadySockets() == std::vector<sf::Socket*>{&socket});
+
+        socketSelector.remove(socket);
+        CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets().empty());
+    }
+
+    SECTION("add() after the handle was reused")
+    {
+        sf::SocketSelector socketSelector;
+
+        // Close a socket without removing it from the selector, the system is free to reuse its handle
+        REQUIRE(socket.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        socketSelector.add(socket);
+        socket.unbind();
+
+        sf::UdpSocket reused;
+        REQUIRE(reused.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        socketSelector.add(reused);
+
+        sf::UdpSocket sender;
+        REQUIRE(sender.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        const std::array<std::uint8_t, 4> data{1, 2, 3, 4};
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, reused.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(reused));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&reused});
     }
 }
@@ -2,10 +2,20 @@
 
 // Other 1st party headers
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
 
 TEST_CASE("[Network] sf::TcpSocket")
 {
@@ -24,4 +34,195 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
     }
+
+    SECTION("Send and receive packets")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        sf::Packet first;
+        first << std::uint32_t{42} << std::string("first");
+        sf::Packet empty;
+        sf::Packet second;
+        second << std::string("second");
+
+        CHECK(sender.send(first) == sf::Socket::Status::Done);
+        CHECK(sender.send(std::vector<sf::Packet*>{&second, &empty, &first}) == sf::Socket::Status::Done);
+        CHECK(sender.send(std::vector<sf::Packet*>{}) == sf::Socket::Status::Error);
+
+        sf::Packet    packet;
+        std::uint32_t number = 0;
+        std::string   string;
+        REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+        CHECK((packet >> number >> string));
+        CHECK(number == 42);
+        CHECK(string == "first");
+
+        REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+        CHECK((packet >> string));
+        CHECK(string == "second");
+
+        REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+        CHECK(packet.getDataSize() == 0);
+
+        REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+        CHECK((packet >> number >> string));
+        CHECK(number == 42);
+        CHECK(string == "first");
+    }
+
+    SECTION("Receive packets read ahead")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        std::vector<sf::Packet>  packets(10);
+        std::vector<sf::Packet*> pointers;
+        for (std::uint32_t i = 0; i < packets.size(); ++i)
+        {
+            packets[i] << i;
+            pointers.push_back(&packets[i]);
+        }
+
+        const std::string raw = "raw";
+        REQUIRE(sender.send(pointers) == sf::Socket::Status::Done);
+        REQUIRE(sender.send(raw.data(), raw.size()) == sf::Socket::Status::Done);
+
+        // The selector must report the data that the socket has already read ahead
+        sf::SocketSelector selector;
+        selector.add(receiver);
+        for (std::uint32_t i = 0; i < packets.size(); ++i)
+        {
+            REQUIRE(selector.wait(sf::seconds(1)));
+            CHECK(selector.isReady(receiver));
+
+            sf::Packet    packet;
+            std::uint32_t number = 0;
+            REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> number));
+            CHECK(number == i);
+        }
+
+        // Raw receives continue right after the last packet
+        std::string received;
+        while (received.size() < raw.size())
+        {
+            std::array<char, 16> buffer{};
+            std::size_t          count = 0;
+            REQUIRE(receiver.receive(buffer.data(), buffer.size(), count) == sf::Socket::Status::Done);
+            received.append(buffer.data(), count);
+        }
+        CHECK(received == raw);
+
+        // Once everything has been consumed, the socket isn't ready anymore
+        CHECK(!selector.wait(sf::milliseconds(10)));
+        CHECK(!selector.isReady(receiver));
+    }
+
+    SECTION("Move a socket holding data read ahead")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        sf::Packet first;
+        first << std::uint32_t{1};
+        sf::Packet second;
+        second << std::uint32_t{2};
+        REQUIRE(sender.send(std::vector<sf::Packet*>{&first, &second}) == sf::Socket::Status::Done);
+
+        sf::Packet    packet;
+        std::uint32_t number = 0;
+        REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+        CHECK((packet >> number));
+        CHECK(number == 1);
+
+        // The data read ahead moves along with the socket
+        sf::TcpSocket      moved(std::move(receiver));
+        sf::SocketSelector selector;
+        selector.add(moved);
+        REQUIRE(selector.wait(sf::seconds(1)));
+        CHECK(selector.isReady(moved));
+        REQUIRE(moved.receive(packet) == sf::Socket::Status::Done);
+        CHECK((packet >> number));
+        CHECK(number == 2);
+
+        // The moved-from socket holds nothing anymore
+        std::array<char, 16> buffer{};
+        std::size_t          count = 0;
+        // NOLINTNEXTLINE(bugprone-use-after-move)
+        CHECK(receiver.receive(buffer.data(), buffer.size(), count) != sf::Socket::Status::Done);
+        CHECK(count == 0);
+    }
+
+    SECTION("Receive packets larger than the read-ahead buffer")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        std::vector<std::uint8_t> data(200'000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 7);
+
+        sf::Packet large;
+        large.append(data.data(), data.size());
+        sf::Packet small;
+        small << std::uint32_t{42};
+        REQUIRE(sender.send(std::vector<sf::Packet*>{&large, &small, &large}) == sf::Socket::Status::Done);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            sf::Packet packet;
+            REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+            REQUIRE(packet.getDataSize() == data.size());
+            CHECK(std::memcmp(packet.getData(), data.data(), data.size()) == 0);
+
+            if (i == 0)
+            {
+                std::uint32_t number = 0;
+                REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+                CHECK((packet >> number));
+                CHECK(number == 42);
+            }
+        }
+    }
+
+    SECTION("Announced size larger than the data sent")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        // A peer claiming a 4 GB packet must not make the receiver allocate it up front
+        const std::array<std::uint8_t, 8> data{0xFF, 0xFF, 0xFF, 0xFF, 1, 2, 3, 4};
+        REQUIRE(sender.send(data.data(), data.size()) == sf::Socket::Status::Done);
+        sender.disconnect();
+
+        sf::Packet packet;
+        CHECK(receiver.receive(packet) == sf::Socket::Status::Disconnected);
+        CHECK(packet.getDataSize() == 0);
+    }
 }
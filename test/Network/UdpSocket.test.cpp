@@ -1,8 +1,14 @@
 #include <SFML/Network/UdpSocket.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Network] sf::UdpSocket")
 {
@@ -35,4 +41,53 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("Send and receive datagram batches")
+    {
+        sf::UdpSocket sender;
+        sf::UdpSocket receiver;
+        REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::vector<sf::Packet>              packets(100);
+        std::vector<sf::UdpSocket::Datagram> datagrams;
+        for (std::uint32_t i = 0; i < packets.size(); ++i)
+        {
+            packets[i] << i;
+            datagrams.push_back({&packets[i], sf::IpAddress::LocalHost, receiver.getLocalPort()});
+        }
+
+        std::size_t sent = 0;
+        CHECK(sender.send(std::vector<sf::UdpSocket::Datagram>{{&packets[0]}}, sent) == sf::Socket::Status::Error);
+        CHECK(sent == 0);
+        REQUIRE(sender.send(datagrams, sent) == sf::Socket::Status::Done);
+        CHECK(sent == packets.size());
+
+        std::vector<sf::Packet>              received(packets.size());
+        std::vector<sf::UdpSocket::Datagram> receivedDatagrams;
+        for (sf::Packet& packet : received)
+            receivedDatagrams.push_back({&packet});
+
+        std::uint32_t next = 0;
+        while (next < packets.size())
+        {
+            std::size_t count = 0;
+            REQUIRE(receiver.receive(receivedDatagrams, count) == sf::Socket::Status::Done);
+            REQUIRE(count > 0);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint32_t number = 0;
+                CHECK((*receivedDatagrams[i].packet >> number));
+                CHECK(number == next++);
+                CHECK(receivedDatagrams[i].remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(receivedDatagrams[i].remotePort == sender.getLocalPort());
+            }
+        }
+
+        receiver.setBlocking(false);
+        std::size_t count = 0;
+        CHECK(receiver.receive(receivedDatagrams, count) == sf::Socket::Status::NotReady);
+        CHECK(count == 0);
+    }
 }